@@ -0,0 +1,296 @@
+#include "pico/stdlib.h"
+
+#include "hardware/gpio.h"
+#include "hardware/i2c.h"
+#include "hardware/pwm.h"
+
+#include <string.h>
+
+#include "hw_config.h"
+
+#if IO_BRIDGE
+
+#include "io_bridge.h"
+#include "console.h"
+
+// Filled by the emulator core, run by io_bridge_run() while busy is set
+static uint32_t queue[IO_BRIDGE_QUEUE_LEN];
+static uint32_t queue_len, queue_pos;
+static uint32_t run_len;
+static bool run_keep;
+
+static uint32_t results[IO_BRIDGE_RESULT_LEN];
+static uint32_t results_len, results_pos;
+
+static volatile bool busy;
+static bool error;
+
+static bool pin_allowed(uint32_t pin)
+{
+    return pin < 32 && (IO_BRIDGE_GPIO_MASK & (1u << pin));
+}
+
+static void put_result(uint32_t w)
+{
+    if (results_len < IO_BRIDGE_RESULT_LEN)
+        results[results_len++] = w;
+}
+
+// Runs the first run_len words of the queue, and empties it unless run_keep is set
+static void io_bridge_run(void)
+{
+    uint32_t i = 0;
+    uint32_t end = run_len;
+
+#if IO_BRIDGE_CORE0
+    uint32_t delay_left = IO_BRIDGE_DELAY_MAX_US;
+#endif
+
+    results_len = 0;
+    results_pos = 0;
+    error = false;
+
+    while (i < end && !error)
+    {
+        uint32_t cmd = queue[i++];
+        uint32_t pin = cmd & 0xFF;
+
+        switch (IO_OP(cmd))
+        {
+        case IO_OP_END:
+            i = end;
+            break;
+
+        case IO_OP_GPIO_INIT:
+            if (!pin_allowed(pin))
+            {
+                error = true;
+                break;
+            }
+            gpio_init(pin);
+            gpio_set_dir(pin, cmd & (1u << 8));
+            gpio_set_pulls(pin, cmd & (1u << 9), cmd & (1u << 10));
+            break;
+
+        case IO_OP_GPIO_PUT:
+            if (end - i < 2 || (queue[i] & ~IO_BRIDGE_GPIO_MASK))
+            {
+                error = true;
+                break;
+            }
+            gpio_put_masked(queue[i], queue[i + 1]);
+            i += 2;
+            break;
+
+        case IO_OP_GPIO_GET:
+            put_result(gpio_get_all());
+            break;
+
+        case IO_OP_DELAY:
+        {
+            uint32_t us = cmd & 0xFFFFFF;
+#if IO_BRIDGE_CORE0
+            // The console core also serves USB and the terminal, it can't sleep for long
+            if (us > delay_left)
+            {
+                error = true;
+                break;
+            }
+            delay_left -= us;
+#endif
+            sleep_us(us);
+            break;
+        }
+
+        case IO_OP_I2C_FREQ:
+        {
+            uint32_t hz = (cmd & 0xFFFFFF) * 100;
+            if (!hz || hz > IO_BRIDGE_I2C_FREQ_MAX)
+            {
+                error = true;
+                break;
+            }
+            i2c_set_baudrate(IO_BRIDGE_I2C_INST, hz);
+            break;
+        }
+
+        case IO_OP_I2C_WRITE:
+        case IO_OP_I2C_READ:
+        {
+            uint8_t addr = cmd & 0x7F;
+            bool nostop = cmd & 0x80;
+            uint32_t len = (cmd >> 8) & 0xFFF;
+            uint32_t words = (len + 3) / 4;
+            uint timeout = IO_BRIDGE_I2C_TIMEOUT_US * (len + 1);
+
+#if IO_BRIDGE_CORE0
+            // Transfers share the delay budget, by the time they really take
+            if (!delay_left)
+            {
+                error = true;
+                break;
+            }
+            if (timeout > delay_left)
+                timeout = delay_left;
+            uint32_t start = time_us_32();
+#endif
+
+            if (IO_OP(cmd) == IO_OP_I2C_WRITE)
+            {
+                if (end - i < words)
+                {
+                    error = true;
+                    break;
+                }
+                put_result(i2c_write_timeout_us(IO_BRIDGE_I2C_INST, addr, (uint8_t *)&queue[i], len, nostop, timeout));
+                i += words;
+            }
+            else
+            {
+                if (IO_BRIDGE_RESULT_LEN - results_len < words + 1)
+                {
+                    error = true;
+                    break;
+                }
+                uint32_t *r = &results[results_len++];
+                memset(&results[results_len], 0, words * 4);
+                *r = i2c_read_timeout_us(IO_BRIDGE_I2C_INST, addr, (uint8_t *)&results[results_len], len, nostop, timeout);
+                results_len += words;
+            }
+
+#if IO_BRIDGE_CORE0
+            uint32_t took = time_us_32() - start;
+            delay_left -= took < delay_left ? took : delay_left;
+#endif
+            break;
+        }
+
+        case IO_OP_PWM_CONFIG:
+        {
+            if (!pin_allowed(pin) || end - i < 1)
+            {
+                error = true;
+                break;
+            }
+            uint32_t cfg = queue[i++];
+            uint slice = pwm_gpio_to_slice_num(pin);
+            gpio_set_function(pin, GPIO_FUNC_PWM);
+            pwm_set_wrap(slice, cfg & 0xFFFF);
+            float div = ((cfg >> 16) & 0xFFF) / 16.0f;
+            pwm_set_clkdiv(slice, div < 1.0f ? 1.0f : div);
+            pwm_set_enabled(slice, true);
+            break;
+        }
+
+        case IO_OP_PWM_LEVEL:
+            if (!pin_allowed(pin))
+            {
+                error = true;
+                break;
+            }
+            pwm_set_gpio_level(pin, (cmd >> 8) & 0xFFFF);
+            break;
+
+        default:
+            error = true;
+            break;
+        }
+    }
+
+    if (!run_keep)
+        queue_len = 0;
+}
+
+void io_bridge_init(void)
+{
+    i2c_init(IO_BRIDGE_I2C_INST, IO_BRIDGE_I2C_FREQ);
+    gpio_set_function(IO_BRIDGE_I2C_SDA, GPIO_FUNC_I2C);
+    gpio_set_function(IO_BRIDGE_I2C_SCL, GPIO_FUNC_I2C);
+    gpio_pull_up(IO_BRIDGE_I2C_SDA);
+    gpio_pull_up(IO_BRIDGE_I2C_SCL);
+}
+
+void io_bridge_task(void)
+{
+#if IO_BRIDGE_CORE0
+    if (!busy)
+        return;
+    __mem_fence_acquire();
+
+    io_bridge_run();
+
+    __mem_fence_release();
+    busy = false;
+#endif
+}
+
+void io_bridge_queue(uint32_t w)
+{
+    // The queue can't change under a running batch
+    while (busy)
+        tight_loop_contents();
+
+    if (queue_len < IO_BRIDGE_QUEUE_LEN)
+        queue[queue_len++] = w;
+}
+
+void io_bridge_set_pos(uint32_t pos)
+{
+    queue_pos = pos;
+}
+
+uint32_t io_bridge_get_len(void)
+{
+    return queue_len;
+}
+
+void io_bridge_write(uint32_t w)
+{
+    while (busy)
+        tight_loop_contents();
+
+    if (queue_pos >= IO_BRIDGE_QUEUE_LEN)
+        return;
+
+    queue[queue_pos++] = w;
+    if (queue_len < queue_pos)
+        queue_len = queue_pos;
+}
+
+void io_bridge_doorbell(uint32_t len)
+{
+    while (busy)
+        tight_loop_contents();
+
+    run_keep = len != 0;
+    run_len = run_keep && len < queue_len ? len : queue_len;
+
+#if IO_BRIDGE_CORE0
+    // Hand the batch over to the console core and keep emulating
+    __mem_fence_release();
+    busy = true;
+    console_doorbell();
+#else
+    io_bridge_run();
+#endif
+}
+
+uint32_t io_bridge_status(void)
+{
+    if (busy)
+        return IO_BRIDGE_STATUS_BUSY;
+    __mem_fence_acquire();
+
+    return results_len | (error ? IO_BRIDGE_STATUS_ERROR : 0);
+}
+
+uint32_t io_bridge_result(void)
+{
+    while (busy)
+        tight_loop_contents();
+    __mem_fence_acquire();
+
+    return results_pos < results_len ? results[results_pos++] : 0;
+}
+
+#endif
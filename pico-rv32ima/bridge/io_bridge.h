@@ -0,0 +1,58 @@
+#ifndef _IO_BRIDGE_H
+#define _IO_BRIDGE_H
+
+#include "hw_config.h"
+#if IO_BRIDGE
+
+#include <stdint.h>
+
+// Fastest I2C mode (Fast-mode Plus)
+#define IO_BRIDGE_I2C_FREQ_MAX (1000 * 1000)
+
+// Queue and result buffer sizes, in words
+#define IO_BRIDGE_QUEUE_LEN 1024
+#define IO_BRIDGE_RESULT_LEN 1024
+
+// Status word returned by io_bridge_status()
+#define IO_BRIDGE_STATUS_RESULTS_MASK 0xFFFF // result words produced by the last batch
+#define IO_BRIDGE_STATUS_ERROR (1u << 30)    // the last batch stopped on a bad command
+#define IO_BRIDGE_STATUS_BUSY (1u << 31)     // a batch is running
+
+// Commands, the opcode is in bits 24-31 of the first word
+#define IO_OP(w) ((w) >> 24)
+#define IO_OP_END 0x00        // end of the batch
+#define IO_OP_GPIO_INIT 0x01  // bits 0-7: pin, 8: output, 9: pull-up, 10: pull-down
+#define IO_OP_GPIO_PUT 0x02   // next words: mask, value
+#define IO_OP_GPIO_GET 0x03   // result: state of all pins
+#define IO_OP_DELAY 0x04      // bits 0-23: microseconds, IO_BRIDGE_DELAY_MAX_US in total per batch with IO_BRIDGE_CORE0
+#define IO_OP_I2C_FREQ 0x10   // bits 0-23: SCL frequency in Hz / 100, up to IO_BRIDGE_I2C_FREQ_MAX
+#define IO_OP_I2C_WRITE 0x11  // bits 0-6: address, 7: no stop, 8-19: length, next words: data
+                              // result: bytes written, or a negative error
+#define IO_OP_I2C_READ 0x12   // bits 0-6: address, 7: no stop, 8-19: length
+                              // result: bytes read, or a negative error, then the data words
+                              // with IO_BRIDGE_CORE0, both transfers count against IO_BRIDGE_DELAY_MAX_US
+#define IO_OP_PWM_CONFIG 0x20 // bits 0-7: pin, next word: bits 0-15: wrap, 16-27: clock divider * 16
+#define IO_OP_PWM_LEVEL 0x21  // bits 0-7: pin, 8-23: level
+
+void io_bridge_init(void);
+
+// Console core: runs a queued batch
+void io_bridge_task(void);
+
+// Emulator core
+void io_bridge_queue(uint32_t w);
+
+// Block fill: writes queue words from a position, the queue grows to cover them
+void io_bridge_set_pos(uint32_t pos);
+uint32_t io_bridge_get_len(void);
+void io_bridge_write(uint32_t w);
+
+// Runs the whole queue and empties it, or with a length, runs that many words from the start and
+// keeps them, so a prepared batch can be patched through io_bridge_write() and run again
+void io_bridge_doorbell(uint32_t len);
+uint32_t io_bridge_status(void);
+uint32_t io_bridge_result(void);
+
+#endif
+
+#endif
@@ -0,0 +1,114 @@
+// -------------------------------------------------- //
+// This file is autogenerated by pioasm; do not edit! //
+// -------------------------------------------------- //
+
+#if !PICO_NO_HARDWARE
+#include "hardware/pio.h"
+#endif
+
+// --------- //
+// spi_cpha0 //
+// --------- //
+
+#define spi_cpha0_wrap_target 0
+#define spi_cpha0_wrap 1
+
+static const uint16_t spi_cpha0_program_instructions[] = {
+            //     .wrap_target
+    0x6101, //  0: out    pins, 1         side 0 [1]
+    0x5101, //  1: in     pins, 1         side 1 [1]
+            //     .wrap
+};
+
+#if !PICO_NO_HARDWARE
+static const struct pio_program spi_cpha0_program = {
+    .instructions = spi_cpha0_program_instructions,
+    .length = 2,
+    .origin = -1,
+};
+
+static inline pio_sm_config spi_cpha0_program_get_default_config(uint offset)
+{
+    pio_sm_config c = pio_get_default_sm_config();
+    sm_config_set_wrap(&c, offset + spi_cpha0_wrap_target, offset + spi_cpha0_wrap);
+    sm_config_set_sideset(&c, 1, false, false);
+    return c;
+}
+
+static inline void spi_cpha0_program_init(PIO pio, uint sm, uint offset, uint pin_sck, uint pin_mosi, uint pin_miso)
+{
+    // SPI mode 0, MSB first, 8-bit frames. Each bit takes 4 PIO cycles, the clock stays low
+    // while the TX FIFO is empty. Mode 2 is obtained by inverting the SCK output.
+    pio_sm_config c = spi_cpha0_program_get_default_config(offset);
+    sm_config_set_out_pins(&c, pin_mosi, 1);
+    sm_config_set_in_pins(&c, pin_miso);
+    sm_config_set_sideset_pins(&c, pin_sck);
+    // Shift left, autopull and autopush every 8 bits. 8-bit writes to the TX FIFO are
+    // replicated across the word, so the byte always lands in the top bits of the OSR.
+    sm_config_set_out_shift(&c, false, true, 8);
+    sm_config_set_in_shift(&c, false, true, 8);
+    pio_sm_set_pins_with_mask(pio, sm, 0, (1u << pin_sck) | (1u << pin_mosi));
+    pio_sm_set_pindirs_with_mask(pio, sm, (1u << pin_sck) | (1u << pin_mosi), (1u << pin_sck) | (1u << pin_mosi) | (1u << pin_miso));
+    pio_gpio_init(pio, pin_mosi);
+    pio_gpio_init(pio, pin_miso);
+    pio_gpio_init(pio, pin_sck);
+    // MISO is sampled by the PIO, skip the input synchronizer to get the full half bit of setup time
+    hw_set_bits(&pio->input_sync_bypass, 1u << pin_miso);
+    pio_sm_init(pio, sm, offset, &c);
+    pio_sm_set_enabled(pio, sm, true);
+}
+
+#endif
+
+// --------- //
+// spi_cpha1 //
+// --------- //
+
+#define spi_cpha1_wrap_target 0
+#define spi_cpha1_wrap 2
+
+static const uint16_t spi_cpha1_program_instructions[] = {
+            //     .wrap_target
+    0x6021, //  0: out    x, 1            side 0
+    0xb101, //  1: mov    pins, x         side 1 [1]
+    0x4001, //  2: in     pins, 1         side 0
+            //     .wrap
+};
+
+#if !PICO_NO_HARDWARE
+static const struct pio_program spi_cpha1_program = {
+    .instructions = spi_cpha1_program_instructions,
+    .length = 3,
+    .origin = -1,
+};
+
+static inline pio_sm_config spi_cpha1_program_get_default_config(uint offset)
+{
+    pio_sm_config c = pio_get_default_sm_config();
+    sm_config_set_wrap(&c, offset + spi_cpha1_wrap_target, offset + spi_cpha1_wrap);
+    sm_config_set_sideset(&c, 1, false, false);
+    return c;
+}
+
+static inline void spi_cpha1_program_init(PIO pio, uint sm, uint offset, uint pin_sck, uint pin_mosi, uint pin_miso)
+{
+    // SPI mode 1, as spi_cpha0 otherwise: data goes out on the leading edge and is sampled
+    // on the trailing one. The clock stays low while stalled on the empty TX FIFO. Mode 3 is
+    // obtained by inverting the SCK output.
+    pio_sm_config c = spi_cpha1_program_get_default_config(offset);
+    sm_config_set_out_pins(&c, pin_mosi, 1);
+    sm_config_set_in_pins(&c, pin_miso);
+    sm_config_set_sideset_pins(&c, pin_sck);
+    sm_config_set_out_shift(&c, false, true, 8);
+    sm_config_set_in_shift(&c, false, true, 8);
+    pio_sm_set_pins_with_mask(pio, sm, 0, (1u << pin_sck) | (1u << pin_mosi));
+    pio_sm_set_pindirs_with_mask(pio, sm, (1u << pin_sck) | (1u << pin_mosi), (1u << pin_sck) | (1u << pin_mosi) | (1u << pin_miso));
+    pio_gpio_init(pio, pin_mosi);
+    pio_gpio_init(pio, pin_miso);
+    pio_gpio_init(pio, pin_sck);
+    hw_set_bits(&pio->input_sync_bypass, 1u << pin_miso);
+    pio_sm_init(pio, sm, offset, &c);
+    pio_sm_set_enabled(pio, sm, true);
+}
+
+#endif
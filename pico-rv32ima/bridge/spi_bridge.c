@@ -0,0 +1,131 @@
+#include "pico/stdlib.h"
+
+#include "hardware/gpio.h"
+#include "hardware/pio.h"
+#include "hardware/dma.h"
+#include "hardware/clocks.h"
+
+#include "hw_config.h"
+#include "spi_bridge.h"
+
+#include "pio/spi.pio.h"
+
+static PIO spiPio = pio0;
+static uint spiSm;
+static uint cpha0Offset, cpha1Offset;
+
+static uint tx_chan, rx_chan;
+static uint8_t spi_buf[SPI_BRIDGE_BUF_LEN] __attribute__((aligned(4)));
+static uint32_t spi_len;
+
+static uint32_t spi_khz = SPI_BRIDGE_FREQ / 1000;
+static bool spi_cpol = SPI_BRIDGE_CPOL;
+static bool spi_cpha = SPI_BRIDGE_CPHA;
+
+static void spi_bridge_apply(void)
+{
+    // Restarts the state machine on the program for the clock phase, with the clock idle
+    pio_sm_set_enabled(spiPio, spiSm, false);
+    if (spi_cpha)
+        spi_cpha1_program_init(spiPio, spiSm, cpha1Offset, SPI_BRIDGE_SCK, SPI_BRIDGE_MOSI, SPI_BRIDGE_MISO);
+    else
+        spi_cpha0_program_init(spiPio, spiSm, cpha0Offset, SPI_BRIDGE_SCK, SPI_BRIDGE_MOSI, SPI_BRIDGE_MISO);
+
+    // 4 PIO cycles per bit, within the range of the PIO clock divider
+    float div = (float)clock_get_hz(clk_sys) / (spi_khz * 1000.0f * 4);
+    if (div < 1.0f)
+        div = 1.0f;
+    if (div > 65535.0f)
+        div = 65535.0f;
+    pio_sm_set_clkdiv(spiPio, spiSm, div);
+    gpio_set_outover(SPI_BRIDGE_SCK, spi_cpol ? GPIO_OVERRIDE_INVERT : GPIO_OVERRIDE_NORMAL);
+}
+
+void spi_bridge_init(void)
+{
+    gpio_init(SPI_BRIDGE_CS);
+    gpio_set_dir(SPI_BRIDGE_CS, GPIO_OUT);
+    gpio_put(SPI_BRIDGE_CS, true);
+
+    spiSm = pio_claim_unused_sm(spiPio, true);
+    cpha0Offset = pio_add_program(spiPio, &spi_cpha0_program);
+    cpha1Offset = pio_add_program(spiPio, &spi_cpha1_program);
+    spi_bridge_apply();
+
+    // Buffer -> TX FIFO and RX FIFO -> buffer, paced by the state machine
+    tx_chan = dma_claim_unused_channel(true);
+    dma_channel_config c = dma_channel_get_default_config(tx_chan);
+    channel_config_set_transfer_data_size(&c, DMA_SIZE_8);
+    channel_config_set_read_increment(&c, true);
+    channel_config_set_write_increment(&c, false);
+    channel_config_set_dreq(&c, pio_get_dreq(spiPio, spiSm, true));
+    dma_channel_configure(tx_chan, &c, &spiPio->txf[spiSm], spi_buf, 0, false);
+
+    rx_chan = dma_claim_unused_channel(true);
+    c = dma_channel_get_default_config(rx_chan);
+    channel_config_set_transfer_data_size(&c, DMA_SIZE_8);
+    channel_config_set_read_increment(&c, false);
+    channel_config_set_write_increment(&c, true);
+    channel_config_set_dreq(&c, pio_get_dreq(spiPio, spiSm, false));
+    dma_channel_configure(rx_chan, &c, spi_buf, &spiPio->rxf[spiSm], 0, false);
+}
+
+void spi_bridge_config(uint32_t cfg)
+{
+    dma_channel_wait_for_finish_blocking(rx_chan);
+
+    if (cfg & SPI_BRIDGE_CFG_KHZ_MASK)
+        spi_khz = cfg & SPI_BRIDGE_CFG_KHZ_MASK;
+    spi_cpol = cfg & SPI_BRIDGE_CFG_CPOL;
+    spi_cpha = cfg & SPI_BRIDGE_CFG_CPHA;
+    spi_bridge_apply();
+}
+
+uint32_t spi_bridge_get_config(void)
+{
+    return spi_khz | (spi_cpol ? SPI_BRIDGE_CFG_CPOL : 0) | (spi_cpha ? SPI_BRIDGE_CFG_CPHA : 0);
+}
+
+uint8_t spi_bridge_xfer_byte(uint8_t tx)
+{
+    dma_channel_wait_for_finish_blocking(rx_chan);
+
+    pio_sm_put_blocking(spiPio, spiSm, (uint32_t)tx << 24);
+    return pio_sm_get_blocking(spiPio, spiSm);
+}
+
+void spi_bridge_buf_write(uint32_t offset, uint32_t w)
+{
+    offset &= SPI_BRIDGE_BUF_LEN - 4;
+    dma_channel_wait_for_finish_blocking(rx_chan);
+    *(uint32_t *)&spi_buf[offset] = w;
+}
+
+uint32_t spi_bridge_buf_read(uint32_t offset)
+{
+    offset &= SPI_BRIDGE_BUF_LEN - 4;
+    dma_channel_wait_for_finish_blocking(rx_chan);
+    return *(uint32_t *)&spi_buf[offset];
+}
+
+void spi_bridge_start(uint32_t len)
+{
+    if (len > SPI_BRIDGE_BUF_LEN)
+        len = SPI_BRIDGE_BUF_LEN;
+
+    dma_channel_wait_for_finish_blocking(rx_chan);
+    spi_len = len;
+    if (!len)
+        return;
+
+    // The RX channel trails the TX channel, so received bytes never overwrite unsent ones
+    dma_channel_set_write_addr(rx_chan, spi_buf, false);
+    dma_channel_set_trans_count(rx_chan, len, true);
+    dma_channel_set_read_addr(tx_chan, spi_buf, false);
+    dma_channel_set_trans_count(tx_chan, len, true);
+}
+
+uint32_t spi_bridge_status(void)
+{
+    return spi_len | (dma_channel_is_busy(rx_chan) ? SPI_BRIDGE_STATUS_BUSY : 0);
+}
@@ -0,0 +1,32 @@
+#ifndef _SPI_BRIDGE_H
+#define _SPI_BRIDGE_H
+
+#include <stdint.h>
+#include <stdbool.h>
+
+// Size of the block transfer buffer, in bytes
+#define SPI_BRIDGE_BUF_LEN 4096
+
+// Status word returned by spi_bridge_status()
+#define SPI_BRIDGE_STATUS_LEN_MASK 0xFFFF // length of the last block transfer
+#define SPI_BRIDGE_STATUS_BUSY (1u << 31) // a block transfer is running
+
+// Config word for spi_bridge_config()
+#define SPI_BRIDGE_CFG_KHZ_MASK 0xFFFF // SCK frequency in kHz, 0 keeps the current one
+#define SPI_BRIDGE_CFG_CPOL (1u << 16) // clock idles high
+#define SPI_BRIDGE_CFG_CPHA (1u << 17) // data sampled on the trailing clock edge
+
+void spi_bridge_init(void);
+void spi_bridge_config(uint32_t cfg);
+uint32_t spi_bridge_get_config(void);
+
+// Single byte transfer, waits for any block transfer first
+uint8_t spi_bridge_xfer_byte(uint8_t tx);
+
+// Block transfers, the received bytes replace the sent ones in the buffer
+void spi_bridge_buf_write(uint32_t offset, uint32_t w);
+uint32_t spi_bridge_buf_read(uint32_t offset);
+void spi_bridge_start(uint32_t len);
+uint32_t spi_bridge_status(void);
+
+#endif
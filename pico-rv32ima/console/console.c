@@ -1,4 +1,7 @@
 #include "pico/stdlib.h"
+#include "pico/multicore.h"
+#include "hardware/sync.h"
+#include "hardware/irq.h"
 
 #include <stdio.h>
 #include <stdlib.h>
@@ -16,12 +19,109 @@
 #include "tusb.h"
 #endif
 
-queue_t ser_screen_queue, kb_queue;
+#if USB_XFER
+#include "xfer.h"
+#endif
+
+#if USB_NET
+#include "net.h"
+#endif
+
+#if USB_MSC
+#include "msc_disk.h"
+#endif
+
+#if IO_BRIDGE
+#include "io_bridge.h"
+#endif
+
+#if PSRAM_COPROC
+#include "psram_coproc.h"
+#endif
+
+queue_t kb_queue;
+
+// Pending CONSOLE_EV_* bits, only modified on the console core with interrupts off
+static volatile uint32_t console_events = CONSOLE_EV_ALL;
+
+// Set by the emulator core when it rings the doorbell, cleared by the FIFO interrupt
+static volatile bool doorbell_pending;
+
+static repeating_timer_t tick_timer;
+
+#if CONSOLE_CDC || CONSOLE_UART
+// Serial output ring. console_putc() on the emulator core is the only writer and
+// ser_console_task() on the console core the only reader, so no lock is needed.
+static char ser_out_buf[SER_OUT_LEN];
+static volatile uint32_t ser_out_head, ser_out_tail;
+#endif
 
 #if CONSOLE_CDC
 static uint8_t cdc_buf[IO_QUEUE_LEN];
 #endif
 
+void console_signal(uint32_t ev)
+{
+    uint32_t save = save_and_disable_interrupts();
+    console_events |= ev;
+    restore_interrupts(save);
+    __sev();
+}
+
+void console_doorbell(void)
+{
+    // The FIFO only goes to the other core
+    if (get_core_num() == 0)
+    {
+        console_signal(CONSOLE_EV_DOORBELL);
+        return;
+    }
+
+    // Make the new data visible before looking at the flag
+    __dmb();
+    if (doorbell_pending)
+        return;
+
+    doorbell_pending = true;
+    __dmb();
+    if (multicore_fifo_wready())
+        multicore_fifo_push_blocking(0);
+}
+
+static void console_fifo_irq(void)
+{
+    // Drain before clearing the flag: a doorbell rung after the clear pushes a word that must
+    // stay in the FIFO and raise a new interrupt, one rung before it is covered by this pass
+    multicore_fifo_drain();
+    multicore_fifo_clear_irq();
+    __dmb();
+    doorbell_pending = false;
+    console_signal(CONSOLE_EV_DOORBELL);
+}
+
+static bool console_tick(repeating_timer_t *t)
+{
+    (void)t;
+    console_signal(CONSOLE_EV_TICK);
+    return true;
+}
+
+#if CONSOLE_CDC
+static void console_usb_irq(void)
+{
+    console_signal(CONSOLE_EV_USB);
+}
+#endif
+
+#if CONSOLE_UART
+static void console_uart_irq(void)
+{
+    // Masked until console_task() has read the FIFO, or it would keep firing
+    uart_set_irq_enables(UART_INSTANCE, false, false);
+    console_signal(CONSOLE_EV_UART);
+}
+#endif
+
 void console_init(void)
 {
 
@@ -31,44 +131,80 @@ void console_init(void)
 
 #if CONSOLE_CDC
     tusb_init();
+    // Runs after the TinyUSB handler, which queues the events for tud_task()
+    irq_add_shared_handler(USBCTRL_IRQ, console_usb_irq, PICO_SHARED_IRQ_HANDLER_LOWEST_ORDER_PRIORITY);
 #endif
 
 #if CONSOLE_UART
     uart_init(UART_INSTANCE, UART_BAUD_RATE);
     gpio_set_function(UART_TX_PIN, GPIO_FUNC_UART);
     gpio_set_function(UART_RX_PIN, GPIO_FUNC_UART);
-#endif
-
-#if CONSOLE_CDC || CONSOLE_UART
-    queue_init(&ser_screen_queue, sizeof(char), IO_QUEUE_LEN);
+    irq_set_exclusive_handler(UART_IRQ_NUM(UART_INSTANCE), console_uart_irq);
+    irq_set_enabled(UART_IRQ_NUM(UART_INSTANCE), true);
+    uart_set_irq_enables(UART_INSTANCE, true, false);
 #endif
 
     queue_init(&kb_queue, sizeof(char), IO_QUEUE_LEN);
+
+    // Doorbell from the emulator core
+    multicore_fifo_drain();
+    multicore_fifo_clear_irq();
+    irq_set_exclusive_handler(SIO_FIFO_IRQ_NUM(0), console_fifo_irq);
+    irq_set_enabled(SIO_FIFO_IRQ_NUM(0), true);
+
+    add_repeating_timer_ms(CONSOLE_TICK_MS, console_tick, NULL, &tick_timer);
 }
 
 #if CONSOLE_CDC || CONSOLE_UART
 static void ser_console_task(void)
 {
-    while (!queue_is_empty(&ser_screen_queue))
+    uint32_t tail = ser_out_tail;
+    uint32_t count = ser_out_head - tail;
+    __mem_fence_acquire();
+
+    // Move contiguous spans of the ring at once
+    while (count)
     {
-        uint8_t c;
-        queue_remove_blocking(&ser_screen_queue, &c);
+        uint32_t idx = tail & (SER_OUT_LEN - 1);
+        uint32_t span = SER_OUT_LEN - idx;
+        if (span > count)
+            span = count;
 
 #if CONSOLE_CDC
         if (tud_cdc_connected())
-            tud_cdc_write_char(c);
+        {
+            // Leave whatever doesn't fit in the TinyUSB FIFO for the next pass
+            uint32_t avail = tud_cdc_write_available();
+            if (span > avail)
+                span = avail;
+            if (!span)
+                break;
+            tud_cdc_write(&ser_out_buf[idx], span);
+        }
 #endif
 
 #if CONSOLE_UART
-        uart_putc_raw(UART_INSTANCE, c);
+        uart_write_blocking(UART_INSTANCE, (const uint8_t *)&ser_out_buf[idx], span);
 #endif
+
+        tail += span;
+        count -= span;
     }
 
+    __mem_fence_release();
+    ser_out_tail = tail;
+
 #if CONSOLE_CDC
-    if (tud_cdc_connected() && tud_cdc_available())
+    // Only take as much as kb_queue can hold, the rest stays in the TinyUSB FIFO
+    // and the host is NAKed until there is room again
+    uint32_t space = IO_QUEUE_LEN - queue_get_level(&kb_queue);
+    if (space > sizeof(cdc_buf))
+        space = sizeof(cdc_buf);
+
+    if (tud_cdc_connected() && tud_cdc_available() && space)
     {
-        uint32_t count = tud_cdc_read(cdc_buf, sizeof(cdc_buf));
-        for (int i = 0; i < count; i++)
+        uint32_t n = tud_cdc_read(cdc_buf, space);
+        for (int i = 0; i < n; i++)
             queue_try_add(&kb_queue, &cdc_buf[i]);
     }
 
@@ -78,39 +214,100 @@ static void ser_console_task(void)
 
 #if CONSOLE_UART
     uint8_t uart_in_ch;
-    while (uart_is_readable(UART_INSTANCE))
+    while (uart_is_readable(UART_INSTANCE) && !queue_is_full(&kb_queue))
     {
         uart_read_blocking(UART_INSTANCE, &uart_in_ch, 1);
         queue_try_add(&kb_queue, &uart_in_ch);
     }
+
+    // With kb_queue full, the interrupt stays off until console_read() rings the doorbell
+    if (!queue_is_full(&kb_queue))
+        uart_set_irq_enables(UART_INSTANCE, true, false);
 #endif
 }
 #endif
 
 void console_task(void)
 {
+    uint32_t save = save_and_disable_interrupts();
+    uint32_t ev = console_events;
+    console_events = 0;
+    restore_interrupts(save);
+
+    // Interrupts, the tick alarm and the doorbell all end the wait
+    if (!ev)
+    {
+        __wfe();
+        return;
+    }
+
 #if CONSOLE_CDC
-    tud_task();
+    if (ev & (CONSOLE_EV_USB | CONSOLE_EV_DOORBELL))
+        tud_task();
 #endif
 
 #if CONSOLE_CDC || CONSOLE_UART
-    ser_console_task();
+    if (ev & (CONSOLE_EV_USB | CONSOLE_EV_DOORBELL | CONSOLE_EV_UART))
+        ser_console_task();
+#endif
+
+#if USB_XFER
+    if (ev & (CONSOLE_EV_USB | CONSOLE_EV_DOORBELL))
+        xfer_task();
+#endif
+
+#if USB_NET
+    if (ev & (CONSOLE_EV_USB | CONSOLE_EV_DOORBELL))
+        net_task();
+#endif
+
+#if USB_MSC
+    if (ev & (CONSOLE_EV_USB | CONSOLE_EV_TICK))
+        msc_task();
+#endif
+
+#if IO_BRIDGE
+    if (ev & CONSOLE_EV_DOORBELL)
+        io_bridge_task();
+#endif
+
+#if PSRAM_COPROC
+    if (ev & CONSOLE_EV_DOORBELL)
+        psram_coproc_task();
 #endif
 
 #if CONSOLE_VGA
-    terminal_task();
+    if (ev & (CONSOLE_EV_DOORBELL | CONSOLE_EV_PS2))
+        terminal_task();
+
+    if (ev & CONSOLE_EV_TICK)
+        terminal_blink();
+
+    // More output than one pass handles
+    if (!queue_is_empty(&term_screen_queue))
+        console_signal(CONSOLE_EV_DOORBELL);
 #endif
 }
 
 void console_putc(char c)
 {
 #if CONSOLE_CDC || CONSOLE_UART
-    queue_add_blocking(&ser_screen_queue, &c);
+    // Wait for the console core to make room
+    uint32_t head = ser_out_head;
+    while (head - ser_out_tail == SER_OUT_LEN)
+        tight_loop_contents();
+    __mem_fence_acquire();
+
+    ser_out_buf[head & (SER_OUT_LEN - 1)] = c;
+    __mem_fence_release();
+    ser_out_head = head + 1;
 #endif
 
 #if CONSOLE_VGA
     queue_add_blocking(&term_screen_queue, &c);
 #endif
+
+    console_doorbell();
 }
 
 void console_puts(char s[])
@@ -5,11 +5,33 @@
 
 #define IO_QUEUE_LEN 64
 
-extern queue_t ser_screen_queue, kb_queue;
+// Serial output buffer size, must be a power of two
+#define SER_OUT_LEN 1024
+
+// Console core events, each one selects the work done by the next console_task() pass
+#define CONSOLE_EV_USB (1u << 0)      // USB controller interrupt
+#define CONSOLE_EV_DOORBELL (1u << 1) // the emulator core produced or consumed console/USB data
+#define CONSOLE_EV_UART (1u << 2)     // UART RX interrupt
+#define CONSOLE_EV_PS2 (1u << 3)      // PS/2 frame received
+#define CONSOLE_EV_TICK (1u << 4)     // cursor blink and housekeeping alarm
+#define CONSOLE_EV_ALL 0x1F
+
+// Cursor blink and housekeeping period
+#define CONSOLE_TICK_MS 150
+
+extern queue_t kb_queue;
 
 void console_init(void);
+
+// Handles the pending events, or sleeps until the next one
 void console_task(void);
 
+// Console core interrupt handlers: flags an event and wakes the core
+void console_signal(uint32_t ev);
+
+// Emulator core: wakes the console core after touching a buffer it services
+void console_doorbell(void);
+
 void console_putc(char c);
 void console_puts(char s[]);
 void console_printf(const char *format, ...);
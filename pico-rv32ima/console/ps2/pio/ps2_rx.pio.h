@@ -0,0 +1,68 @@
+// -------------------------------------------------- //
+// This file is autogenerated by pioasm; do not edit! //
+// -------------------------------------------------- //
+
+#if !PICO_NO_HARDWARE
+#include "hardware/pio.h"
+#endif
+
+// ------ //
+// ps2_rx //
+// ------ //
+
+#define ps2_rx_wrap_target 0
+#define ps2_rx_wrap 9
+
+static const uint16_t ps2_rx_program_instructions[] = {
+            //     .wrap_target
+    0x2021, //  0: wait   0 pin, 1
+    0x00c9, //  1: jmp    pin, 9
+    0xe029, //  2: set    x, 9
+    0x20a1, //  3: wait   1 pin, 1
+    0x2021, //  4: wait   0 pin, 1
+    0x4001, //  5: in     pins, 1
+    0x20a1, //  6: wait   1 pin, 1
+    0x0044, //  7: jmp    x--, 4
+    0x8000, //  8: push   noblock
+    0x20a1, //  9: wait   1 pin, 1
+            //     .wrap
+};
+
+#if !PICO_NO_HARDWARE
+static const struct pio_program ps2_rx_program = {
+    .instructions = ps2_rx_program_instructions,
+    .length = 10,
+    .origin = -1,
+};
+
+static inline pio_sm_config ps2_rx_program_get_default_config(uint offset)
+{
+    pio_sm_config c = pio_get_default_sm_config();
+    sm_config_set_wrap(&c, offset + ps2_rx_wrap_target, offset + ps2_rx_wrap);
+    return c;
+}
+
+static inline void ps2_rx_program_init(PIO pio, uint sm, uint offset, uint data_pin)
+{
+    // The clock pin must be data_pin + 1. The program waits for a falling clock edge with
+    // data low (start bit), then samples 8 data bits, parity and stop on the following
+    // falling edges and pushes them as one frame. Frames that don't begin with a valid
+    // start bit are skipped, which also resynchronizes after a glitch.
+    pio_sm_config c = ps2_rx_program_get_default_config(offset);
+    // IN pins: data is pin 0, clock is pin 1. JMP pin is data, for the start bit check.
+    sm_config_set_in_pins(&c, data_pin);
+    sm_config_set_jmp_pin(&c, data_pin);
+    // Shift right, no autopush: the 10 received bits end up in bits 22-31
+    sm_config_set_in_shift(&c, true, false, 32);
+    // Only the RX FIFO is used, join it for 8 frames of buffering
+    sm_config_set_fifo_join(&c, PIO_FIFO_JOIN_RX);
+    // Run at 1 MHz, plenty for the 10-16.7 kHz PS/2 clock
+    sm_config_set_clkdiv(&c, (float)clock_get_hz(clk_sys) / 1000000.0f);
+    // Both pins are inputs
+    pio_sm_set_consecutive_pindirs(pio, sm, data_pin, 2, false);
+    // Load our configuration, and jump to the start of the program
+    pio_sm_init(pio, sm, offset, &c);
+    pio_sm_set_enabled(pio, sm, true);
+}
+
+#endif
@@ -2,9 +2,14 @@
 #if CONSOLE_VGA
 
 #include "ps2.h"
+#include "console.h"
 #include "pico/stdlib.h"
 
 #include "hardware/gpio.h"
+#include "hardware/pio.h"
+#include "hardware/clocks.h"
+
+#include "pio/ps2_rx.pio.h"
 
 #define BUFFER_SIZE 45
 
@@ -18,6 +23,10 @@
 static int ps2DataPin;
 static int ps2ClkPin;
 
+// PIO state machine receiving PS/2 frames
+static PIO ps2Pio = pio0;
+static uint ps2Sm;
+
 static volatile uint8_t buffer[BUFFER_SIZE];
 static volatile uint8_t head = 0, tail = 0;
 static uint16_t CharBuffer = 0;
@@ -65,47 +74,32 @@ const PS2Keymap_t PS2Keymap_US = {
 	 0, 0, 0, PS2_F7},
 	0};
 
-static void ps2_gpio_callback(uint gpio, uint32_t events)
+// Runs once per received frame (instead of once per clock edge)
+static void ps2_pio_irq_handler(void)
 {
-	if (gpio == ps2ClkPin)
+	while (!pio_sm_is_rx_fifo_empty(ps2Pio, ps2Sm))
 	{
-		static uint8_t bitcount = 0;
-		static uint8_t incoming = 0;
-		static uint32_t prev_ms = 0;
-		uint32_t now_ms;
-		uint8_t n, val;
+		// Bits 0-7: data, bit 8: odd parity, bit 9: stop
+		uint32_t frame = pio_sm_get(ps2Pio, ps2Sm) >> 22;
+		uint8_t incoming = frame & 0xFF;
+		uint8_t parity = (frame >> 8) & 1;
+		uint8_t stop = (frame >> 9) & 1;
 
-		val = gpio_get(ps2DataPin);
+		// Drop frames with a bad stop bit or parity
+		if (!stop || __builtin_parity(incoming) == parity)
+			continue;
 
-		now_ms = to_ms_since_boot(get_absolute_time());
-
-		if (now_ms - prev_ms > 250)
+		uint8_t i = head + 1;
+		if (i >= BUFFER_SIZE)
+			i = 0;
+		if (i != tail)
 		{
-			bitcount = 0;
-			incoming = 0;
-		}
-		prev_ms = now_ms;
-
-		n = bitcount - 1;
-		if (n <= 7)
-		{
-			incoming |= (val << n);
-		}
-		bitcount++;
-		if (bitcount == 11)
-		{
-			uint8_t i = head + 1;
-			if (i >= BUFFER_SIZE)
-				i = 0;
-			if (i != tail)
-			{
-				buffer[i] = incoming;
-				head = i;
-			}
-			bitcount = 0;
-			incoming = 0;
+			buffer[i] = incoming;
+			head = i;
 		}
 	}
+
+	console_signal(CONSOLE_EV_PS2);
 }
 
 static uint8_t get_scan_code(void)
@@ -318,7 +312,19 @@ void PS2_init(int d, int c)
 	gpio_set_pulls(ps2ClkPin, false, true);
 	gpio_set_pulls(ps2DataPin, false, true);
 
-	gpio_set_irq_enabled_with_callback(ps2ClkPin, GPIO_IRQ_EDGE_FALL, true, &ps2_gpio_callback);
+	// The PIO program addresses the clock pin relative to the data pin
+	if (ps2ClkPin != ps2DataPin + 1)
+		panic("PS/2 clock pin must be the data pin + 1");
+
+	ps2Sm = pio_claim_unused_sm(ps2Pio, true);
+	uint offset = pio_add_program(ps2Pio, &ps2_rx_program);
+	ps2_rx_program_init(ps2Pio, ps2Sm, offset, ps2DataPin);
+
+	// Interrupt when a frame is waiting in the RX FIFO
+	uint irq = ps2Pio == pio0 ? PIO0_IRQ_0 : PIO1_IRQ_0;
+	pio_set_irq0_source_enabled(ps2Pio, pis_sm0_rx_fifo_not_empty + ps2Sm, true);
+	irq_set_exclusive_handler(irq, ps2_pio_irq_handler);
+	irq_set_enabled(irq, true);
 }
 
 void PS2_selectKeyMap(PS2Keymap_t *km)
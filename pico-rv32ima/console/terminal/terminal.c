@@ -2,6 +2,7 @@
 #if CONSOLE_VGA
 
 #include "pico/stdlib.h"
+#include <stdio.h>
 #include <stdlib.h>
 
 #include <ctype.h>
@@ -33,160 +34,494 @@ void terminal_init(void)
     queue_init(&term_screen_queue, sizeof(char), IO_QUEUE_LEN);
 }
 
-static bool termCharAvailable()
+// Maximum number of numeric parameters kept for a CSI sequence
+#define CSI_MAX_PARAMS 16
+
+// Maximum number of bytes handled per terminal_task() call
+#define TERM_BATCH 256
+
+// Escape sequence parser states
+enum
 {
-    return !queue_is_empty(&term_screen_queue);
+    TERM_GROUND,  // Printing characters
+    TERM_ESCAPE,  // Got ESC
+    TERM_CHARSET, // Got ESC followed by an intermediate byte, skip the designator
+    TERM_CSI      // Collecting CSI parameters
+};
+
+static uint8_t termState = TERM_GROUND;
+static uint csiParams[CSI_MAX_PARAMS];
+static uint csiParamCount;
+static bool csiPrivate;
+
+// Current attributes
+static uint8_t attrFg = WHITE;
+static uint8_t attrBg = BLACK;
+static bool attrReverse = false;
+
+// Saved cursor (ESC 7 / ESC 8, CSI s / CSI u)
+static uint savedX, savedY;
+static uint8_t savedFg = WHITE, savedBg = BLACK;
+static bool savedReverse = false;
+
+static bool cursorVisible = true;
+
+static void applyAttributes()
+{
+    fg_col = attrReverse ? attrBg : attrFg;
+    bg_col = attrReverse ? attrFg : attrBg;
 }
 
-static char termGetChar()
+static void saveCursor()
 {
-    char c;
-    queue_remove_blocking(&term_screen_queue, &c);
-    return c;
+    savedX = cr_x;
+    savedY = cr_y;
+    savedFg = attrFg;
+    savedBg = attrBg;
+    savedReverse = attrReverse;
 }
 
-static char termPeekChar()
+static void restoreCursor()
 {
-    char c;
-    queue_peek_blocking(&term_screen_queue, &c);
-    return c;
+    VGA_cursor(savedX, savedY);
+    attrFg = savedFg;
+    attrBg = savedBg;
+    attrReverse = savedReverse;
+    applyAttributes();
+}
+
+static void termReply(const char *s)
+{
+    while (*s)
+        queue_try_add(&kb_queue, s++);
 }
 
-static void clearInLine()
+// Clears columns [from, to) of a line
+static void clearInLine(uint y, uint from, uint to)
 {
-    for (int i = cr_x; i < TERM_WIDTH; i++)
+    if (to > TERM_WIDTH)
+        to = TERM_WIDTH;
+    if (from >= to)
+        return;
+
+    for (int i = from; i < to; i++)
     {
-        termBuf[cr_y][i] = 0;
-        bgColBuf[cr_y][i] = 0;
+        termBuf[y][i] = 0;
+        bgColBuf[y][i] = 0;
     }
 }
 
-static void runCSI(char csi, uint *param, uint paramCount)
+static void clearLines(uint from, uint to)
 {
-    // Clear screen
-    if (csi == 'J')
+    if (from >= to)
+        return;
+
+    dma_memset(termBuf[from], 0, (to - from) * TERM_WIDTH);
+    dma_memset(bgColBuf[from], 0, (to - from) * TERM_WIDTH);
+}
+
+// Returns parameter i, or def if it was omitted or zero
+static uint csiParam(uint i, uint def)
+{
+    if (i >= csiParamCount || csiParams[i] == 0)
+        return def;
+    return csiParams[i];
+}
+
+static void insertChars(uint n)
+{
+    if (n > TERM_WIDTH - cr_x)
+        n = TERM_WIDTH - cr_x;
+
+    for (int i = TERM_WIDTH - 1; i >= (int)(cr_x + n); i--)
     {
-        // Clear everything
-        if (paramCount && param[0] == 2)
-            VGA_clear();
+        termBuf[cr_y][i] = termBuf[cr_y][i - n];
+        fgColBuf[cr_y][i] = fgColBuf[cr_y][i - n];
+        bgColBuf[cr_y][i] = bgColBuf[cr_y][i - n];
+    }
+    clearInLine(cr_y, cr_x, cr_x + n);
+}
 
-        // Clear everything after cursor
-        else if (paramCount == 0)
+static void deleteChars(uint n)
+{
+    if (n > TERM_WIDTH - cr_x)
+        n = TERM_WIDTH - cr_x;
+
+    for (int i = cr_x; i < TERM_WIDTH - n; i++)
+    {
+        termBuf[cr_y][i] = termBuf[cr_y][i + n];
+        fgColBuf[cr_y][i] = fgColBuf[cr_y][i + n];
+        bgColBuf[cr_y][i] = bgColBuf[cr_y][i + n];
+    }
+    clearInLine(cr_y, TERM_WIDTH - n, TERM_WIDTH);
+}
+
+static void selectGraphicRendition()
+{
+    if (csiParamCount == 0)
+        csiParams[csiParamCount++] = 0;
+
+    for (int i = 0; i < csiParamCount; i++)
+    {
+        uint p = csiParams[i];
+
+        // Reset parameters
+        if (p == 0)
         {
-            clearInLine();
-            if (cr_y < TERM_HEIGHT - 1)
-                for (int i = cr_y + 1; i < TERM_HEIGHT; i++)
-                {
-                    dma_memset(termBuf[i], 0, TERM_WIDTH);
-                    dma_memset(bgColBuf[i], 0, TERM_WIDTH);
-                }
+            attrFg = WHITE;
+            attrBg = BLACK;
+            attrReverse = false;
         }
+        else if (p == 7)
+            attrReverse = true;
+        else if (p == 27)
+            attrReverse = false;
+        // Foreground color
+        else if (p >= 30 && p <= 37)
+            attrFg = termColors[p - 30];
+        else if (p >= 90 && p <= 97)
+            attrFg = termColors[p - 90];
+        else if (p == 39)
+            attrFg = WHITE;
+        // Background color
+        else if (p >= 40 && p <= 47)
+            attrBg = termColors[p - 40];
+        else if (p >= 100 && p <= 107)
+            attrBg = termColors[p - 100];
+        else if (p == 49)
+            attrBg = BLACK;
     }
 
-    // Clear in line
-    else if (csi == 'K')
+    applyAttributes();
+}
+
+static void setPrivateMode(bool set)
+{
+    for (int i = 0; i < csiParamCount; i++)
     {
-        // Clear from cursor to end of line
-        if (paramCount == 0)
-            clearInLine();
+        // Cursor visibility
+        if (csiParams[i] == 25)
+            cursorVisible = set;
+
+        // Alternate screen: there is only one buffer, so just start from a clean screen
+        else if (csiParams[i] == 1049 || csiParams[i] == 47 || csiParams[i] == 1047)
+        {
+            if (set)
+                saveCursor();
+            VGA_setScrollRegion(0, TERM_HEIGHT - 1);
+            VGA_clear();
+            if (!set)
+                restoreCursor();
+        }
     }
+}
 
-    // Cursor movement
-    else if (csi == 'H')
+static void runCSI(char csi)
+{
+    uint top, bottom;
+    char reply[16];
+
+    if (csiPrivate)
     {
-        // Move to top left corner
-        if (paramCount == 0)
-            VGA_cursor(0, 0);
-        else if (paramCount == 2)
-            VGA_cursor(param[1], param[0]);
+        if (csi == 'h')
+            setPrivateMode(true);
+        else if (csi == 'l')
+            setPrivateMode(false);
+        return;
     }
 
-    // Graphic rendition parameters
-    else if (csi == 'm')
+    switch (csi)
     {
-        // Reset parameters
-        if (paramCount == 0)
+    // Cursor movement
+    case 'A':
+        VGA_cursor(cr_x, (int)cr_y - (int)csiParam(0, 1));
+        break;
+
+    case 'B':
+    case 'e':
+        VGA_cursor(cr_x, cr_y + csiParam(0, 1));
+        break;
+
+    case 'C':
+    case 'a':
+        VGA_cursor(cr_x + csiParam(0, 1), cr_y);
+        break;
+
+    case 'D':
+        VGA_cursor((int)cr_x - (int)csiParam(0, 1), cr_y);
+        break;
+
+    case 'E':
+        VGA_cursor(0, cr_y + csiParam(0, 1));
+        break;
+
+    case 'F':
+        VGA_cursor(0, (int)cr_y - (int)csiParam(0, 1));
+        break;
+
+    case 'G':
+    case '`':
+        VGA_cursor(csiParam(0, 1) - 1, cr_y);
+        break;
+
+    case 'd':
+        VGA_cursor(cr_x, csiParam(0, 1) - 1);
+        break;
+
+    case 'H':
+    case 'f':
+        VGA_cursor(csiParam(1, 1) - 1, csiParam(0, 1) - 1);
+        break;
+
+    // Clear screen
+    case 'J':
+        // Clear everything after cursor
+        if (csiParam(0, 0) == 0)
         {
-            fg_col = WHITE;
-            bg_col = BLACK;
+            clearInLine(cr_y, cr_x, TERM_WIDTH);
+            clearLines(cr_y + 1, TERM_HEIGHT);
         }
+        // Clear everything before cursor
+        else if (csiParam(0, 0) == 1)
+        {
+            clearLines(0, cr_y);
+            clearInLine(cr_y, 0, cr_x + 1);
+        }
+        // Clear everything
         else
-            for (int i = 0; i < paramCount; i++)
-            {
-                // Foreground color
-                if (param[i] >= 30 && param[i] <= 37)
-                    fg_col = termColors[param[i] - 30];
-                // Background color
-                else if (param[i] >= 40 && param[i] <= 47)
-                    bg_col = termColors[param[i] - 40];
-            }
+            VGA_clear();
+        break;
+
+    // Clear in line
+    case 'K':
+        if (csiParam(0, 0) == 0)
+            clearInLine(cr_y, cr_x, TERM_WIDTH);
+        else if (csiParam(0, 0) == 1)
+            clearInLine(cr_y, 0, cr_x + 1);
+        else
+            clearInLine(cr_y, 0, TERM_WIDTH);
+        break;
+
+    case 'X':
+        clearInLine(cr_y, cr_x, cr_x + csiParam(0, 1));
+        break;
+
+    // Insert and delete characters
+    case '@':
+        insertChars(csiParam(0, 1));
+        break;
+
+    case 'P':
+        deleteChars(csiParam(0, 1));
+        break;
+
+    // Insert and delete lines, only inside the scrolling region
+    case 'L':
+        VGA_getScrollRegion(&top, &bottom);
+        if (cr_y >= top && cr_y <= bottom)
+            VGA_scrollRegionDown(cr_y, bottom, csiParam(0, 1));
+        VGA_cursor(0, cr_y);
+        break;
+
+    case 'M':
+        VGA_getScrollRegion(&top, &bottom);
+        if (cr_y >= top && cr_y <= bottom)
+            VGA_scrollRegionUp(cr_y, bottom, csiParam(0, 1));
+        VGA_cursor(0, cr_y);
+        break;
+
+    // Scroll the whole region
+    case 'S':
+        VGA_getScrollRegion(&top, &bottom);
+        VGA_scrollRegionUp(top, bottom, csiParam(0, 1));
+        break;
+
+    case 'T':
+        VGA_getScrollRegion(&top, &bottom);
+        VGA_scrollRegionDown(top, bottom, csiParam(0, 1));
+        break;
+
+    // Set scrolling region, the cursor goes home
+    case 'r':
+        VGA_setScrollRegion(csiParam(0, 1) - 1, csiParam(1, TERM_HEIGHT) - 1);
+        VGA_cursor(0, 0);
+        break;
+
+    // Graphic rendition parameters
+    case 'm':
+        selectGraphicRendition();
+        break;
+
+    case 's':
+        saveCursor();
+        break;
+
+    case 'u':
+        restoreCursor();
+        break;
+
+    // Device status report
+    case 'n':
+        if (csiParam(0, 0) == 5)
+            termReply("\x1b[0n");
+        else if (csiParam(0, 0) == 6)
+        {
+            sprintf(reply, "\x1b[%u;%uR", cr_y + 1, cr_x + 1);
+            termReply(reply);
+        }
+        break;
+
+    default:
+        break;
     }
 }
 
-static void parseCSI(char *s)
+static void runEscape(char c)
 {
-    uint slen = strlen(s);
+    termState = TERM_GROUND;
 
-    uint params[25];
-    uint paramNum = 0;
-    char csi = s[slen - 1];
-
-    if (slen > 1)
+    switch (c)
     {
-        char *p = strtok(s, ";");
-        while (p != NULL)
-        {
-            if (strlen(p))
-                params[paramNum++] = atoi(p);
-            else
-                params[paramNum++] = 0;
-            p = strtok(NULL, ";");
-        }
+    case CSI:
+        csiParamCount = 0;
+        csiParams[0] = 0;
+        csiPrivate = false;
+        termState = TERM_CSI;
+        break;
+
+    case '7':
+        saveCursor();
+        break;
+
+    case '8':
+        restoreCursor();
+        break;
+
+    // Index, reverse index, next line
+    case 'D':
+        VGA_newline();
+        break;
+
+    case 'M':
+        VGA_reverseIndex();
+        break;
+
+    case 'E':
+        VGA_putc('\r');
+        VGA_newline();
+        break;
+
+    // Full reset
+    case 'c':
+        attrFg = WHITE;
+        attrBg = BLACK;
+        attrReverse = false;
+        applyAttributes();
+        cursorVisible = true;
+        VGA_setScrollRegion(0, TERM_HEIGHT - 1);
+        VGA_clear();
+        VGA_cursor(0, 0);
+        break;
+
+    // Character set designation, the next byte is ignored
+    case '(':
+    case ')':
+    case '*':
+    case '+':
+    case '#':
+        termState = TERM_CHARSET;
+        break;
+
+    case ESC:
+        termState = TERM_ESCAPE;
+        break;
+
+    default:
+        break;
     }
+}
 
-    runCSI(csi, params, paramNum);
+static void collectCSI(char c)
+{
+    if (isdigit(c))
+    {
+        if (csiParamCount == 0)
+            csiParamCount = 1;
+        if (csiParamCount <= CSI_MAX_PARAMS)
+            csiParams[csiParamCount - 1] = csiParams[csiParamCount - 1] * 10 + (c - '0');
+    }
+    else if (c == ';')
+    {
+        if (csiParamCount == 0)
+            csiParamCount = 1;
+        if (csiParamCount < CSI_MAX_PARAMS)
+            csiParams[csiParamCount] = 0;
+        csiParamCount++;
+    }
+    else if (c == '?' || c == '>' || c == '=')
+        csiPrivate = true;
+    else if (c >= 0x40 && c <= 0x7E)
+    {
+        if (csiParamCount > CSI_MAX_PARAMS)
+            csiParamCount = CSI_MAX_PARAMS;
+        termState = TERM_GROUND;
+        runCSI(c);
+    }
+    // Intermediate bytes (0x20-0x2F) are ignored
 }
 
-static void vt100Emu()
+// Feeds one byte to the escape sequence parser, never blocks
+static void termFeed(char c)
 {
-    if (!termCharAvailable())
+    // Cancel any sequence in progress
+    if (c == 0x18 || c == 0x1A)
+    {
+        termState = TERM_GROUND;
         return;
+    }
 
-    int c = termGetChar();
-
-    // Handle escape sequences
     if (c == ESC)
     {
-        int next = termGetChar();
-
-        // Handle CSI escape sequences
-        if (next == CSI)
-        {
+        termState = TERM_ESCAPE;
+        return;
+    }
 
-            char s[100];
-            uint cnt = 0;
-            do
-            {
-                next = termPeekChar();
-                if (!isalpha(next))
-                    termGetChar();
-                s[cnt++] = next;
-
-            } while (isdigit(next) || next == ';');
-            s[cnt] = '\0';
-            termGetChar();
-            parseCSI(s);
-        }
+    // Control characters are executed even in the middle of a sequence
+    if (c == '\r' || c == '\n' || c == '\b' || c == '\t' || c == '\v' || c == '\f')
+    {
+        VGA_putc((c == '\v' || c == '\f') ? '\n' : c);
+        return;
     }
 
-    else
-        VGA_putc(c); // Handle regular characters
+    switch (termState)
+    {
+    case TERM_ESCAPE:
+        runEscape(c);
+        break;
+
+    case TERM_CHARSET:
+        termState = TERM_GROUND;
+        break;
+
+    case TERM_CSI:
+        collectCSI(c);
+        break;
+
+    default:
+        if ((uint8_t)c >= ' ')
+            VGA_putc(c); // Handle regular characters
+        break;
+    }
 }
 
-static uint64_t GetTimeMiliseconds()
+static void vt100Emu()
 {
-    absolute_time_t t = get_absolute_time();
-    return to_ms_since_boot(t);
+    char c;
+    uint n = 0;
+
+    // Consume whatever is queued, partial sequences are kept in the parser state
+    while (n++ < TERM_BATCH && queue_try_remove(&term_screen_queue, &c))
+        termFeed(c);
 }
 
 static const char csiStr[] = {ESC, CSI};
@@ -246,23 +581,23 @@ static void drawCursor(uint x, uint y, bool en)
 
 void terminal_task(void)
 {
-    static uint prevMillis = 0;
-    static uint px, py;
-    static bool en = false;
     vt100Emu();
     handlePs2Keyboard();
-    uint millis = GetTimeMiliseconds();
-    if (millis > prevMillis + 150)
-    {
-        if ((cr_x != px || cr_y != py) && !en)
-            drawCursor(px, py, false);
-        drawCursor(cr_x, cr_y, en);
-        en = !en;
-
-        px = cr_x;
-        py = cr_y;
-        prevMillis = millis;
-    }
+}
+
+// Called every CONSOLE_TICK_MS
+void terminal_blink(void)
+{
+    static uint px, py;
+    static bool en = false;
+
+    if ((cr_x != px || cr_y != py) && !en)
+        drawCursor(px, py, false);
+    drawCursor(cr_x, cr_y, en && cursorVisible);
+    en = !en;
+
+    px = cr_x;
+    py = cr_y;
 }
 
 #endif
\ No newline at end of file
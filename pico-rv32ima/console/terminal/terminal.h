@@ -9,6 +9,7 @@
 extern queue_t term_screen_queue;
 
 void terminal_task(void);
+void terminal_blink(void);
 void terminal_init(void);
 
 #endif
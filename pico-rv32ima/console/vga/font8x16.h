@@ -0,0 +1,268 @@
+// 8x16 version of the 5x7 font in font.h, used by the 640x480 text mode.
+// Each glyph is 16 bytes, one per row, most significant bit is the leftmost pixel.
+// Generated from font.h: glyph rows are doubled vertically and the 5 columns
+// are centered in the 8 pixel cell.
+
+#ifndef FONT8X16_H
+#define FONT8X16_H
+
+static const unsigned char font8x16[] = {
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x38, 0x38, 0x7C, 0x7C, 0x54, 0x54, 0x7C, 0x7C, 0x6C, 0x6C, 0x44, 0x44, 0x38, 0x38, 0x00, 0x00,
+    0x38, 0x38, 0x7C, 0x7C, 0x54, 0x54, 0x7C, 0x7C, 0x44, 0x44, 0x6C, 0x6C, 0x38, 0x38, 0x00, 0x00,
+    0x00, 0x00, 0x28, 0x28, 0x7C, 0x7C, 0x7C, 0x7C, 0x7C, 0x7C, 0x38, 0x38, 0x10, 0x10, 0x00, 0x00,
+    0x00, 0x00, 0x10, 0x10, 0x38, 0x38, 0x7C, 0x7C, 0x7C, 0x7C, 0x38, 0x38, 0x10, 0x10, 0x00, 0x00,
+    0x38, 0x38, 0x28, 0x28, 0x7C, 0x7C, 0x54, 0x54, 0x7C, 0x7C, 0x10, 0x10, 0x38, 0x38, 0x00, 0x00,
+    0x10, 0x10, 0x38, 0x38, 0x7C, 0x7C, 0x7C, 0x7C, 0x7C, 0x7C, 0x10, 0x10, 0x38, 0x38, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x10, 0x10, 0x38, 0x38, 0x38, 0x38, 0x10, 0x10, 0x00, 0x00, 0x00, 0x00,
+    0x7C, 0x7C, 0x7C, 0x7C, 0x6C, 0x6C, 0x44, 0x44, 0x44, 0x44, 0x6C, 0x6C, 0x7C, 0x7C, 0x7C, 0x7C,
+    0x00, 0x00, 0x00, 0x00, 0x10, 0x10, 0x28, 0x28, 0x28, 0x28, 0x10, 0x10, 0x00, 0x00, 0x00, 0x00,
+    0x7C, 0x7C, 0x7C, 0x7C, 0x6C, 0x6C, 0x54, 0x54, 0x54, 0x54, 0x6C, 0x6C, 0x7C, 0x7C, 0x7C, 0x7C,
+    0x00, 0x00, 0x1C, 0x1C, 0x0C, 0x0C, 0x34, 0x34, 0x50, 0x50, 0x50, 0x50, 0x20, 0x20, 0x00, 0x00,
+    0x38, 0x38, 0x44, 0x44, 0x44, 0x44, 0x38, 0x38, 0x10, 0x10, 0x7C, 0x7C, 0x10, 0x10, 0x00, 0x00,
+    0x3C, 0x3C, 0x24, 0x24, 0x3C, 0x3C, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x60, 0x60, 0x00, 0x00,
+    0x3C, 0x3C, 0x24, 0x24, 0x3C, 0x3C, 0x24, 0x24, 0x24, 0x24, 0x2C, 0x2C, 0x60, 0x60, 0x00, 0x00,
+    0x10, 0x10, 0x54, 0x54, 0x38, 0x38, 0x6C, 0x6C, 0x6C, 0x6C, 0x38, 0x38, 0x54, 0x54, 0x10, 0x10,
+    0x40, 0x40, 0x60, 0x60, 0x78, 0x78, 0x7C, 0x7C, 0x78, 0x78, 0x60, 0x60, 0x40, 0x40, 0x00, 0x00,
+    0x04, 0x04, 0x0C, 0x0C, 0x3C, 0x3C, 0x7C, 0x7C, 0x3C, 0x3C, 0x0C, 0x0C, 0x04, 0x04, 0x00, 0x00,
+    0x10, 0x10, 0x38, 0x38, 0x54, 0x54, 0x10, 0x10, 0x54, 0x54, 0x38, 0x38, 0x10, 0x10, 0x00, 0x00,
+    0x6C, 0x6C, 0x6C, 0x6C, 0x6C, 0x6C, 0x6C, 0x6C, 0x6C, 0x6C, 0x00, 0x00, 0x6C, 0x6C, 0x00, 0x00,
+    0x3C, 0x3C, 0x54, 0x54, 0x54, 0x54, 0x34, 0x34, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x00, 0x00,
+    0x18, 0x18, 0x24, 0x24, 0x28, 0x28, 0x14, 0x14, 0x08, 0x08, 0x24, 0x24, 0x24, 0x24, 0x18, 0x18,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7C, 0x7C, 0x7C, 0x7C, 0x00, 0x00,
+    0x10, 0x10, 0x38, 0x38, 0x54, 0x54, 0x10, 0x10, 0x54, 0x54, 0x38, 0x38, 0x10, 0x10, 0x7C, 0x7C,
+    0x00, 0x00, 0x10, 0x10, 0x38, 0x38, 0x54, 0x54, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x00, 0x00,
+    0x00, 0x00, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x54, 0x54, 0x38, 0x38, 0x10, 0x10, 0x00, 0x00,
+    0x00, 0x00, 0x10, 0x10, 0x08, 0x08, 0x7C, 0x7C, 0x08, 0x08, 0x10, 0x10, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x10, 0x10, 0x20, 0x20, 0x7C, 0x7C, 0x20, 0x20, 0x10, 0x10, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x7C, 0x7C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x28, 0x28, 0x7C, 0x7C, 0x7C, 0x7C, 0x28, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x10, 0x10, 0x10, 0x10, 0x38, 0x38, 0x7C, 0x7C, 0x7C, 0x7C, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x7C, 0x7C, 0x7C, 0x7C, 0x38, 0x38, 0x10, 0x10, 0x10, 0x10, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x00, 0x00, 0x10, 0x10, 0x00, 0x00,
+    0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x28, 0x28, 0x28, 0x28, 0x7C, 0x7C, 0x28, 0x28, 0x7C, 0x7C, 0x28, 0x28, 0x28, 0x28, 0x00, 0x00,
+    0x10, 0x10, 0x3C, 0x3C, 0x50, 0x50, 0x38, 0x38, 0x14, 0x14, 0x78, 0x78, 0x10, 0x10, 0x00, 0x00,
+    0x60, 0x60, 0x64, 0x64, 0x08, 0x08, 0x10, 0x10, 0x20, 0x20, 0x4C, 0x4C, 0x0C, 0x0C, 0x00, 0x00,
+    0x20, 0x20, 0x50, 0x50, 0x50, 0x50, 0x20, 0x20, 0x54, 0x54, 0x48, 0x48, 0x34, 0x34, 0x00, 0x00,
+    0x18, 0x18, 0x18, 0x18, 0x10, 0x10, 0x20, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x08, 0x08, 0x10, 0x10, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x10, 0x10, 0x08, 0x08, 0x00, 0x00,
+    0x20, 0x20, 0x10, 0x10, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x10, 0x10, 0x20, 0x20, 0x00, 0x00,
+    0x10, 0x10, 0x54, 0x54, 0x38, 0x38, 0x7C, 0x7C, 0x38, 0x38, 0x54, 0x54, 0x10, 0x10, 0x00, 0x00,
+    0x00, 0x00, 0x10, 0x10, 0x10, 0x10, 0x7C, 0x7C, 0x10, 0x10, 0x10, 0x10, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x18, 0x18, 0x18, 0x10, 0x10, 0x20, 0x20,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7C, 0x7C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x18, 0x18, 0x18, 0x00, 0x00,
+    0x00, 0x00, 0x04, 0x04, 0x08, 0x08, 0x10, 0x10, 0x20, 0x20, 0x40, 0x40, 0x00, 0x00, 0x00, 0x00,
+    0x38, 0x38, 0x44, 0x44, 0x4C, 0x4C, 0x54, 0x54, 0x64, 0x64, 0x44, 0x44, 0x38, 0x38, 0x00, 0x00,
+    0x10, 0x10, 0x30, 0x30, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x38, 0x38, 0x00, 0x00,
+    0x38, 0x38, 0x44, 0x44, 0x04, 0x04, 0x38, 0x38, 0x40, 0x40, 0x40, 0x40, 0x7C, 0x7C, 0x00, 0x00,
+    0x7C, 0x7C, 0x04, 0x04, 0x08, 0x08, 0x18, 0x18, 0x04, 0x04, 0x44, 0x44, 0x38, 0x38, 0x00, 0x00,
+    0x08, 0x08, 0x18, 0x18, 0x28, 0x28, 0x48, 0x48, 0x7C, 0x7C, 0x08, 0x08, 0x08, 0x08, 0x00, 0x00,
+    0x7C, 0x7C, 0x40, 0x40, 0x78, 0x78, 0x04, 0x04, 0x04, 0x04, 0x44, 0x44, 0x38, 0x38, 0x00, 0x00,
+    0x1C, 0x1C, 0x20, 0x20, 0x40, 0x40, 0x78, 0x78, 0x44, 0x44, 0x44, 0x44, 0x38, 0x38, 0x00, 0x00,
+    0x7C, 0x7C, 0x04, 0x04, 0x04, 0x04, 0x08, 0x08, 0x10, 0x10, 0x20, 0x20, 0x40, 0x40, 0x00, 0x00,
+    0x38, 0x38, 0x44, 0x44, 0x44, 0x44, 0x38, 0x38, 0x44, 0x44, 0x44, 0x44, 0x38, 0x38, 0x00, 0x00,
+    0x38, 0x38, 0x44, 0x44, 0x44, 0x44, 0x3C, 0x3C, 0x04, 0x04, 0x08, 0x08, 0x70, 0x70, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x10, 0x10, 0x00, 0x00, 0x10, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x10, 0x10, 0x00, 0x00, 0x10, 0x10, 0x10, 0x10, 0x20, 0x20, 0x00, 0x00,
+    0x04, 0x04, 0x08, 0x08, 0x10, 0x10, 0x20, 0x20, 0x10, 0x10, 0x08, 0x08, 0x04, 0x04, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x7C, 0x7C, 0x00, 0x00, 0x7C, 0x7C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x20, 0x20, 0x10, 0x10, 0x08, 0x08, 0x04, 0x04, 0x08, 0x08, 0x10, 0x10, 0x20, 0x20, 0x00, 0x00,
+    0x38, 0x38, 0x44, 0x44, 0x04, 0x04, 0x18, 0x18, 0x10, 0x10, 0x00, 0x00, 0x10, 0x10, 0x00, 0x00,
+    0x38, 0x38, 0x44, 0x44, 0x54, 0x54, 0x5C, 0x5C, 0x58, 0x58, 0x40, 0x40, 0x3C, 0x3C, 0x00, 0x00,
+    0x10, 0x10, 0x28, 0x28, 0x44, 0x44, 0x44, 0x44, 0x7C, 0x7C, 0x44, 0x44, 0x44, 0x44, 0x00, 0x00,
+    0x78, 0x78, 0x44, 0x44, 0x44, 0x44, 0x78, 0x78, 0x44, 0x44, 0x44, 0x44, 0x78, 0x78, 0x00, 0x00,
+    0x38, 0x38, 0x44, 0x44, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x44, 0x44, 0x38, 0x38, 0x00, 0x00,
+    0x78, 0x78, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x78, 0x78, 0x00, 0x00,
+    0x7C, 0x7C, 0x40, 0x40, 0x40, 0x40, 0x78, 0x78, 0x40, 0x40, 0x40, 0x40, 0x7C, 0x7C, 0x00, 0x00,
+    0x7C, 0x7C, 0x40, 0x40, 0x40, 0x40, 0x78, 0x78, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x00, 0x00,
+    0x3C, 0x3C, 0x44, 0x44, 0x40, 0x40, 0x40, 0x40, 0x4C, 0x4C, 0x44, 0x44, 0x3C, 0x3C, 0x00, 0x00,
+    0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x7C, 0x7C, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x00, 0x00,
+    0x38, 0x38, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x38, 0x38, 0x00, 0x00,
+    0x1C, 0x1C, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x48, 0x48, 0x30, 0x30, 0x00, 0x00,
+    0x44, 0x44, 0x48, 0x48, 0x50, 0x50, 0x60, 0x60, 0x50, 0x50, 0x48, 0x48, 0x44, 0x44, 0x00, 0x00,
+    0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x7C, 0x7C, 0x00, 0x00,
+    0x44, 0x44, 0x6C, 0x6C, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x44, 0x44, 0x44, 0x44, 0x00, 0x00,
+    0x44, 0x44, 0x44, 0x44, 0x64, 0x64, 0x54, 0x54, 0x4C, 0x4C, 0x44, 0x44, 0x44, 0x44, 0x00, 0x00,
+    0x38, 0x38, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x38, 0x38, 0x00, 0x00,
+    0x78, 0x78, 0x44, 0x44, 0x44, 0x44, 0x78, 0x78, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x00, 0x00,
+    0x38, 0x38, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x54, 0x54, 0x48, 0x48, 0x34, 0x34, 0x00, 0x00,
+    0x78, 0x78, 0x44, 0x44, 0x44, 0x44, 0x78, 0x78, 0x50, 0x50, 0x48, 0x48, 0x44, 0x44, 0x00, 0x00,
+    0x38, 0x38, 0x44, 0x44, 0x40, 0x40, 0x38, 0x38, 0x04, 0x04, 0x44, 0x44, 0x38, 0x38, 0x00, 0x00,
+    0x7C, 0x7C, 0x54, 0x54, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x00, 0x00,
+    0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x38, 0x38, 0x00, 0x00,
+    0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x28, 0x28, 0x10, 0x10, 0x00, 0x00,
+    0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x28, 0x28, 0x00, 0x00,
+    0x44, 0x44, 0x44, 0x44, 0x28, 0x28, 0x10, 0x10, 0x28, 0x28, 0x44, 0x44, 0x44, 0x44, 0x00, 0x00,
+    0x44, 0x44, 0x44, 0x44, 0x28, 0x28, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x00, 0x00,
+    0x7C, 0x7C, 0x04, 0x04, 0x08, 0x08, 0x38, 0x38, 0x20, 0x20, 0x40, 0x40, 0x7C, 0x7C, 0x00, 0x00,
+    0x3C, 0x3C, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3C, 0x3C, 0x00, 0x00,
+    0x00, 0x00, 0x40, 0x40, 0x20, 0x20, 0x10, 0x10, 0x08, 0x08, 0x04, 0x04, 0x00, 0x00, 0x00, 0x00,
+    0x3C, 0x3C, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x3C, 0x3C, 0x00, 0x00,
+    0x10, 0x10, 0x28, 0x28, 0x44, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7C, 0x7C, 0x00, 0x00,
+    0x30, 0x30, 0x30, 0x30, 0x10, 0x10, 0x08, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x30, 0x30, 0x08, 0x08, 0x38, 0x38, 0x48, 0x48, 0x3C, 0x3C, 0x00, 0x00,
+    0x40, 0x40, 0x40, 0x40, 0x58, 0x58, 0x64, 0x64, 0x44, 0x44, 0x64, 0x64, 0x58, 0x58, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x38, 0x38, 0x44, 0x44, 0x40, 0x40, 0x44, 0x44, 0x38, 0x38, 0x00, 0x00,
+    0x04, 0x04, 0x04, 0x04, 0x34, 0x34, 0x4C, 0x4C, 0x44, 0x44, 0x4C, 0x4C, 0x34, 0x34, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x38, 0x38, 0x44, 0x44, 0x7C, 0x7C, 0x40, 0x40, 0x38, 0x38, 0x00, 0x00,
+    0x08, 0x08, 0x14, 0x14, 0x10, 0x10, 0x38, 0x38, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x38, 0x38, 0x4C, 0x4C, 0x4C, 0x4C, 0x34, 0x34, 0x04, 0x04, 0x38, 0x38,
+    0x40, 0x40, 0x40, 0x40, 0x58, 0x58, 0x64, 0x64, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x00, 0x00,
+    0x10, 0x10, 0x00, 0x00, 0x30, 0x30, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x38, 0x38, 0x00, 0x00,
+    0x08, 0x08, 0x00, 0x00, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x48, 0x48, 0x30, 0x30, 0x00, 0x00,
+    0x40, 0x40, 0x40, 0x40, 0x48, 0x48, 0x50, 0x50, 0x60, 0x60, 0x50, 0x50, 0x48, 0x48, 0x00, 0x00,
+    0x30, 0x30, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x38, 0x38, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x68, 0x68, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x54, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x58, 0x58, 0x64, 0x64, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x38, 0x38, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x38, 0x38, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x58, 0x58, 0x64, 0x64, 0x64, 0x64, 0x58, 0x58, 0x40, 0x40, 0x40, 0x40,
+    0x00, 0x00, 0x00, 0x00, 0x34, 0x34, 0x4C, 0x4C, 0x4C, 0x4C, 0x34, 0x34, 0x04, 0x04, 0x04, 0x04,
+    0x00, 0x00, 0x00, 0x00, 0x58, 0x58, 0x64, 0x64, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x3C, 0x3C, 0x40, 0x40, 0x38, 0x38, 0x04, 0x04, 0x78, 0x78, 0x00, 0x00,
+    0x10, 0x10, 0x10, 0x10, 0x7C, 0x7C, 0x10, 0x10, 0x10, 0x10, 0x14, 0x14, 0x08, 0x08, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x4C, 0x4C, 0x34, 0x34, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x28, 0x28, 0x10, 0x10, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x44, 0x44, 0x44, 0x44, 0x54, 0x54, 0x54, 0x54, 0x28, 0x28, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x44, 0x44, 0x28, 0x28, 0x10, 0x10, 0x28, 0x28, 0x44, 0x44, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x44, 0x44, 0x44, 0x44, 0x3C, 0x3C, 0x04, 0x04, 0x44, 0x44, 0x38, 0x38,
+    0x00, 0x00, 0x00, 0x00, 0x7C, 0x7C, 0x08, 0x08, 0x10, 0x10, 0x20, 0x20, 0x7C, 0x7C, 0x00, 0x00,
+    0x08, 0x08, 0x10, 0x10, 0x10, 0x10, 0x20, 0x20, 0x10, 0x10, 0x10, 0x10, 0x08, 0x08, 0x00, 0x00,
+    0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x00, 0x00, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x00, 0x00,
+    0x20, 0x20, 0x10, 0x10, 0x10, 0x10, 0x08, 0x08, 0x10, 0x10, 0x10, 0x10, 0x20, 0x20, 0x00, 0x00,
+    0x20, 0x20, 0x54, 0x54, 0x08, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x10, 0x10, 0x38, 0x38, 0x6C, 0x6C, 0x44, 0x44, 0x44, 0x44, 0x7C, 0x7C, 0x00, 0x00, 0x00, 0x00,
+    0x38, 0x38, 0x44, 0x44, 0x40, 0x40, 0x40, 0x40, 0x44, 0x44, 0x38, 0x38, 0x08, 0x08, 0x30, 0x30,
+    0x00, 0x00, 0x44, 0x44, 0x00, 0x00, 0x44, 0x44, 0x44, 0x44, 0x4C, 0x4C, 0x34, 0x34, 0x00, 0x00,
+    0x0C, 0x0C, 0x00, 0x00, 0x38, 0x38, 0x44, 0x44, 0x7C, 0x7C, 0x40, 0x40, 0x3C, 0x3C, 0x00, 0x00,
+    0x7C, 0x7C, 0x00, 0x00, 0x30, 0x30, 0x08, 0x08, 0x38, 0x38, 0x48, 0x48, 0x3C, 0x3C, 0x00, 0x00,
+    0x00, 0x00, 0x44, 0x44, 0x30, 0x30, 0x08, 0x08, 0x38, 0x38, 0x48, 0x48, 0x3C, 0x3C, 0x00, 0x00,
+    0x60, 0x60, 0x00, 0x00, 0x30, 0x30, 0x08, 0x08, 0x38, 0x38, 0x48, 0x48, 0x3C, 0x3C, 0x00, 0x00,
+    0x18, 0x18, 0x00, 0x00, 0x30, 0x30, 0x08, 0x08, 0x38, 0x38, 0x48, 0x48, 0x3C, 0x3C, 0x00, 0x00,
+    0x00, 0x00, 0x3C, 0x3C, 0x60, 0x60, 0x60, 0x60, 0x3C, 0x3C, 0x08, 0x08, 0x18, 0x18, 0x00, 0x00,
+    0x7C, 0x7C, 0x00, 0x00, 0x38, 0x38, 0x44, 0x44, 0x7C, 0x7C, 0x40, 0x40, 0x3C, 0x3C, 0x00, 0x00,
+    0x44, 0x44, 0x00, 0x00, 0x38, 0x38, 0x44, 0x44, 0x7C, 0x7C, 0x40, 0x40, 0x3C, 0x3C, 0x00, 0x00,
+    0x60, 0x60, 0x00, 0x00, 0x38, 0x38, 0x44, 0x44, 0x7C, 0x7C, 0x40, 0x40, 0x3C, 0x3C, 0x00, 0x00,
+    0x14, 0x14, 0x00, 0x00, 0x18, 0x18, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x1C, 0x1C, 0x00, 0x00,
+    0x18, 0x18, 0x24, 0x24, 0x18, 0x18, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x1C, 0x1C, 0x00, 0x00,
+    0x30, 0x30, 0x00, 0x00, 0x18, 0x18, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x1C, 0x1C, 0x00, 0x00,
+    0x54, 0x54, 0x28, 0x28, 0x44, 0x44, 0x44, 0x44, 0x7C, 0x7C, 0x44, 0x44, 0x44, 0x44, 0x00, 0x00,
+    0x10, 0x10, 0x00, 0x00, 0x10, 0x10, 0x28, 0x28, 0x44, 0x44, 0x7C, 0x7C, 0x44, 0x44, 0x44, 0x44,
+    0x18, 0x18, 0x00, 0x00, 0x78, 0x78, 0x40, 0x40, 0x70, 0x70, 0x40, 0x40, 0x78, 0x78, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x3C, 0x3C, 0x08, 0x08, 0x3C, 0x3C, 0x48, 0x48, 0x3C, 0x3C, 0x00, 0x00,
+    0x1C, 0x1C, 0x28, 0x28, 0x48, 0x48, 0x7C, 0x7C, 0x48, 0x48, 0x48, 0x48, 0x4C, 0x4C, 0x00, 0x00,
+    0x38, 0x38, 0x44, 0x44, 0x00, 0x00, 0x38, 0x38, 0x44, 0x44, 0x44, 0x44, 0x38, 0x38, 0x00, 0x00,
+    0x00, 0x00, 0x44, 0x44, 0x38, 0x38, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x38, 0x38, 0x00, 0x00,
+    0x00, 0x00, 0x60, 0x60, 0x00, 0x00, 0x38, 0x38, 0x44, 0x44, 0x44, 0x44, 0x38, 0x38, 0x00, 0x00,
+    0x38, 0x38, 0x44, 0x44, 0x00, 0x00, 0x44, 0x44, 0x44, 0x44, 0x4C, 0x4C, 0x34, 0x34, 0x00, 0x00,
+    0x00, 0x00, 0x60, 0x60, 0x00, 0x00, 0x44, 0x44, 0x44, 0x44, 0x4C, 0x4C, 0x34, 0x34, 0x00, 0x00,
+    0x24, 0x24, 0x00, 0x00, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x1C, 0x1C, 0x04, 0x04, 0x38, 0x38,
+    0x44, 0x44, 0x38, 0x38, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x38, 0x38, 0x00, 0x00,
+    0x44, 0x44, 0x00, 0x00, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x38, 0x38, 0x00, 0x00,
+    0x10, 0x10, 0x10, 0x10, 0x7C, 0x7C, 0x50, 0x50, 0x50, 0x50, 0x7C, 0x7C, 0x10, 0x10, 0x10, 0x10,
+    0x18, 0x18, 0x2C, 0x2C, 0x24, 0x24, 0x70, 0x70, 0x20, 0x20, 0x24, 0x24, 0x7C, 0x7C, 0x00, 0x00,
+    0x6C, 0x6C, 0x6C, 0x6C, 0x38, 0x38, 0x7C, 0x7C, 0x10, 0x10, 0x7C, 0x7C, 0x10, 0x10, 0x10, 0x10,
+    0x70, 0x70, 0x48, 0x48, 0x48, 0x48, 0x70, 0x70, 0x48, 0x48, 0x5C, 0x5C, 0x48, 0x48, 0x48, 0x48,
+    0x0C, 0x0C, 0x14, 0x14, 0x10, 0x10, 0x38, 0x38, 0x10, 0x10, 0x10, 0x10, 0x50, 0x50, 0x60, 0x60,
+    0x0C, 0x0C, 0x00, 0x00, 0x30, 0x30, 0x08, 0x08, 0x38, 0x38, 0x48, 0x48, 0x3C, 0x3C, 0x00, 0x00,
+    0x0C, 0x0C, 0x00, 0x00, 0x18, 0x18, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x1C, 0x1C, 0x00, 0x00,
+    0x00, 0x00, 0x0C, 0x0C, 0x00, 0x00, 0x38, 0x38, 0x44, 0x44, 0x44, 0x44, 0x38, 0x38, 0x00, 0x00,
+    0x00, 0x00, 0x0C, 0x0C, 0x00, 0x00, 0x44, 0x44, 0x44, 0x44, 0x4C, 0x4C, 0x34, 0x34, 0x00, 0x00,
+    0x00, 0x00, 0x3C, 0x3C, 0x00, 0x00, 0x38, 0x38, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x00, 0x00,
+    0x7C, 0x7C, 0x00, 0x00, 0x64, 0x64, 0x74, 0x74, 0x5C, 0x5C, 0x4C, 0x4C, 0x44, 0x44, 0x00, 0x00,
+    0x38, 0x38, 0x48, 0x48, 0x48, 0x48, 0x3C, 0x3C, 0x00, 0x00, 0x7C, 0x7C, 0x00, 0x00, 0x00, 0x00,
+    0x38, 0x38, 0x44, 0x44, 0x44, 0x44, 0x38, 0x38, 0x00, 0x00, 0x7C, 0x7C, 0x00, 0x00, 0x00, 0x00,
+    0x10, 0x10, 0x00, 0x00, 0x10, 0x10, 0x30, 0x30, 0x40, 0x40, 0x44, 0x44, 0x38, 0x38, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7C, 0x7C, 0x40, 0x40, 0x40, 0x40, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7C, 0x7C, 0x04, 0x04, 0x04, 0x04, 0x00, 0x00, 0x00, 0x00,
+    0x40, 0x40, 0x44, 0x44, 0x48, 0x48, 0x5C, 0x5C, 0x24, 0x24, 0x4C, 0x4C, 0x10, 0x10, 0x1C, 0x1C,
+    0x40, 0x40, 0x44, 0x44, 0x48, 0x48, 0x54, 0x54, 0x2C, 0x2C, 0x5C, 0x5C, 0x04, 0x04, 0x04, 0x04,
+    0x10, 0x10, 0x10, 0x10, 0x00, 0x00, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x00, 0x00,
+    0x00, 0x00, 0x14, 0x14, 0x28, 0x28, 0x50, 0x50, 0x28, 0x28, 0x14, 0x14, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x50, 0x50, 0x28, 0x28, 0x14, 0x14, 0x28, 0x28, 0x50, 0x50, 0x00, 0x00, 0x00, 0x00,
+    0x54, 0x54, 0x00, 0x00, 0x54, 0x54, 0x00, 0x00, 0x54, 0x54, 0x00, 0x00, 0x54, 0x54, 0x00, 0x00,
+    0x28, 0x28, 0x54, 0x54, 0x28, 0x28, 0x54, 0x54, 0x28, 0x28, 0x54, 0x54, 0x28, 0x28, 0x54, 0x54,
+    0x7C, 0x7C, 0x54, 0x54, 0x7C, 0x7C, 0x54, 0x54, 0x7C, 0x7C, 0x54, 0x54, 0x7C, 0x7C, 0x54, 0x54,
+    0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08,
+    0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x78, 0x78, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08,
+    0x08, 0x08, 0x08, 0x08, 0x78, 0x78, 0x08, 0x08, 0x78, 0x78, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08,
+    0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x74, 0x74, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7C, 0x7C, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14,
+    0x00, 0x00, 0x00, 0x00, 0x78, 0x78, 0x08, 0x08, 0x78, 0x78, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08,
+    0x14, 0x14, 0x14, 0x14, 0x74, 0x74, 0x04, 0x04, 0x74, 0x74, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14,
+    0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14,
+    0x00, 0x00, 0x00, 0x00, 0x7C, 0x7C, 0x04, 0x04, 0x74, 0x74, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14,
+    0x14, 0x14, 0x14, 0x14, 0x74, 0x74, 0x04, 0x04, 0x7C, 0x7C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x7C, 0x7C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x08, 0x08, 0x08, 0x08, 0x78, 0x78, 0x08, 0x08, 0x78, 0x78, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x78, 0x78, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08,
+    0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x0C, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x7C, 0x7C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7C, 0x7C, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08,
+    0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x0C, 0x0C, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7C, 0x7C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x7C, 0x7C, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08,
+    0x08, 0x08, 0x08, 0x08, 0x0C, 0x0C, 0x08, 0x08, 0x0C, 0x0C, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08,
+    0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14,
+    0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x10, 0x10, 0x1C, 0x1C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x1C, 0x1C, 0x10, 0x10, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14,
+    0x14, 0x14, 0x14, 0x14, 0x74, 0x74, 0x00, 0x00, 0x7C, 0x7C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x7C, 0x7C, 0x00, 0x00, 0x74, 0x74, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14,
+    0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x10, 0x10, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14,
+    0x00, 0x00, 0x00, 0x00, 0x7C, 0x7C, 0x00, 0x00, 0x7C, 0x7C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x14, 0x14, 0x14, 0x14, 0x74, 0x74, 0x00, 0x00, 0x74, 0x74, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14,
+    0x08, 0x08, 0x08, 0x08, 0x7C, 0x7C, 0x00, 0x00, 0x7C, 0x7C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x7C, 0x7C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x7C, 0x7C, 0x00, 0x00, 0x7C, 0x7C, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7C, 0x7C, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14,
+    0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x1C, 0x1C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x08, 0x08, 0x08, 0x08, 0x0C, 0x0C, 0x08, 0x08, 0x0C, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x0C, 0x0C, 0x08, 0x08, 0x0C, 0x0C, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1C, 0x1C, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14,
+    0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x7C, 0x7C, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14,
+    0x08, 0x08, 0x08, 0x08, 0x7C, 0x7C, 0x08, 0x08, 0x7C, 0x7C, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08,
+    0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x78, 0x78, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0C, 0x0C, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08,
+    0x7C, 0x7C, 0x7C, 0x7C, 0x7C, 0x7C, 0x7C, 0x7C, 0x7C, 0x7C, 0x7C, 0x7C, 0x7C, 0x7C, 0x7C, 0x7C,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7C, 0x7C, 0x7C, 0x7C, 0x7C, 0x7C, 0x7C, 0x7C,
+    0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70,
+    0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C,
+    0x7C, 0x7C, 0x7C, 0x7C, 0x7C, 0x7C, 0x7C, 0x7C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x34, 0x34, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x34, 0x34, 0x00, 0x00,
+    0x00, 0x00, 0x38, 0x38, 0x44, 0x44, 0x78, 0x78, 0x44, 0x44, 0x44, 0x44, 0x78, 0x78, 0x40, 0x40,
+    0x00, 0x00, 0x7C, 0x7C, 0x4C, 0x4C, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x00, 0x00,
+    0x00, 0x00, 0x7C, 0x7C, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x00, 0x00,
+    0x7C, 0x7C, 0x44, 0x44, 0x20, 0x20, 0x10, 0x10, 0x20, 0x20, 0x44, 0x44, 0x7C, 0x7C, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x3C, 0x3C, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x30, 0x30, 0x00, 0x00,
+    0x00, 0x00, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x34, 0x34, 0x60, 0x60, 0x00, 0x00,
+    0x00, 0x00, 0x7C, 0x7C, 0x50, 0x50, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x00, 0x00,
+    0x7C, 0x7C, 0x10, 0x10, 0x38, 0x38, 0x44, 0x44, 0x44, 0x44, 0x38, 0x38, 0x10, 0x10, 0x7C, 0x7C,
+    0x10, 0x10, 0x28, 0x28, 0x44, 0x44, 0x7C, 0x7C, 0x44, 0x44, 0x28, 0x28, 0x10, 0x10, 0x00, 0x00,
+    0x10, 0x10, 0x28, 0x28, 0x44, 0x44, 0x44, 0x44, 0x28, 0x28, 0x28, 0x28, 0x6C, 0x6C, 0x00, 0x00,
+    0x18, 0x18, 0x20, 0x20, 0x18, 0x18, 0x38, 0x38, 0x44, 0x44, 0x44, 0x44, 0x38, 0x38, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x38, 0x38, 0x54, 0x54, 0x54, 0x54, 0x38, 0x38, 0x00, 0x00,
+    0x04, 0x04, 0x38, 0x38, 0x4C, 0x4C, 0x54, 0x54, 0x54, 0x54, 0x64, 0x64, 0x38, 0x38, 0x40, 0x40,
+    0x38, 0x38, 0x40, 0x40, 0x40, 0x40, 0x78, 0x78, 0x40, 0x40, 0x40, 0x40, 0x38, 0x38, 0x00, 0x00,
+    0x38, 0x38, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x00, 0x00,
+    0x00, 0x00, 0x7C, 0x7C, 0x00, 0x00, 0x7C, 0x7C, 0x00, 0x00, 0x7C, 0x7C, 0x00, 0x00, 0x00, 0x00,
+    0x10, 0x10, 0x10, 0x10, 0x7C, 0x7C, 0x10, 0x10, 0x10, 0x10, 0x00, 0x00, 0x7C, 0x7C, 0x00, 0x00,
+    0x20, 0x20, 0x10, 0x10, 0x08, 0x08, 0x10, 0x10, 0x20, 0x20, 0x00, 0x00, 0x7C, 0x7C, 0x00, 0x00,
+    0x08, 0x08, 0x10, 0x10, 0x20, 0x20, 0x10, 0x10, 0x08, 0x08, 0x00, 0x00, 0x7C, 0x7C, 0x00, 0x00,
+    0x1C, 0x1C, 0x14, 0x14, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+    0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x50, 0x50, 0x50, 0x50, 0x70, 0x70,
+    0x18, 0x18, 0x18, 0x18, 0x00, 0x00, 0x7C, 0x7C, 0x00, 0x00, 0x18, 0x18, 0x18, 0x18, 0x00, 0x00,
+    0x00, 0x00, 0x74, 0x74, 0x5C, 0x5C, 0x00, 0x00, 0x74, 0x74, 0x5C, 0x5C, 0x00, 0x00, 0x00, 0x00,
+    0x38, 0x38, 0x6C, 0x6C, 0x6C, 0x6C, 0x38, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x18, 0x18, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x1C, 0x1C, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x50, 0x50, 0x50, 0x50, 0x30, 0x30, 0x10, 0x10,
+    0x38, 0x38, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x38, 0x38, 0x0C, 0x0C, 0x18, 0x18, 0x30, 0x30, 0x3C, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x3C, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
+};
+
+#endif // FONT8X16_H
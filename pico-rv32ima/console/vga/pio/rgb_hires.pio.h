@@ -0,0 +1,69 @@
+// -------------------------------------------------- //
+// This file is autogenerated by pioasm; do not edit! //
+// -------------------------------------------------- //
+
+#if !PICO_NO_HARDWARE
+#include "hardware/pio.h"
+#endif
+
+// --------- //
+// rgb_hires //
+// --------- //
+
+#define rgb_hires_wrap_target 2
+#define rgb_hires_wrap 8
+
+static const uint16_t rgb_hires_program_instructions[] = {
+    0x80a0, //  0: pull   block
+    0x6040, //  1: out    y, 32
+            //     .wrap_target
+    0xe000, //  2: set    pins, 0
+    0xa022, //  3: mov    x, y
+    0x23c1, //  4: wait   1 irq, 1               [3]
+    0x6303, //  5: out    pins, 3                [3]
+    0x6103, //  6: out    pins, 3                [1]
+    0x6062, //  7: out    null, 2
+    0x0045, //  8: jmp    x--, 5
+            //     .wrap
+};
+
+#if !PICO_NO_HARDWARE
+static const struct pio_program rgb_hires_program = {
+    .instructions = rgb_hires_program_instructions,
+    .length = 9,
+    .origin = -1,
+};
+
+static inline pio_sm_config rgb_hires_program_get_default_config(uint offset)
+{
+    pio_sm_config c = pio_get_default_sm_config();
+    sm_config_set_wrap(&c, offset + rgb_hires_wrap_target, offset + rgb_hires_wrap);
+    return c;
+}
+
+static inline void rgb_hires_program_init(PIO pio, uint sm, uint offset, uint pin)
+{
+    // Same pin setup as the rgb program, but every pixel is 4 cycles at 100 MHz (25 MHz pixel clock).
+    // Each byte holds two pixels (bits 0-2 and 3-5), bits 6-7 are discarded.
+    pio_sm_config c = rgb_hires_program_get_default_config(offset);
+    // Map the state machine's SET and OUT pin group to three pins, the `pin`
+    // parameter to this function is the lowest one. These groups overlap.
+    sm_config_set_set_pins(&c, pin, 3);
+    sm_config_set_out_pins(&c, pin, 3);
+    // Shift right, autopull whole 32 bit words (4 bytes, 8 pixels) fed by DMA
+    sm_config_set_out_shift(&c, true, true, 32);
+    // Only the TX FIFO is used, join it for 8 words of buffering
+    sm_config_set_fifo_join(&c, PIO_FIFO_JOIN_TX);
+    // Set clock division (100 MHz state machine)
+    sm_config_set_clkdiv(&c, (float)SYS_FREQ / 100000.0f);
+    // Set this pin's GPIO function (connect PIO to the pad)
+    pio_gpio_init(pio, pin);
+    pio_gpio_init(pio, pin + 1);
+    pio_gpio_init(pio, pin + 2);
+    // Set the pin direction to output at the PIO (3 pins)
+    pio_sm_set_consecutive_pindirs(pio, sm, pin, 3, true);
+    // Load our configuration, and jump to the start of the program
+    pio_sm_init(pio, sm, offset, &c);
+}
+
+#endif
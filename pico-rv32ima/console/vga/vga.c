@@ -1,6 +1,8 @@
 /**
  * Hunter Adams (vha3@cornell.edu)
  * Modified by Vlad Tomoiaga (tvlad1234) to be used as a 320x240 text display (with 640x480 timings)
+ * or, with VGA_HIRES, as a 640x480 text display (80x30 characters) using the 5x7 font
+ * doubled vertically into 8x16 cells
  * VGA driver using PIO assembler
  *
  * HARDWARE CONNECTIONS
@@ -12,9 +14,10 @@
  *  - RP2040 GND ---> VGA GND
  *
  * RESOURCES USED
- *  - PIO state machines 0, 1, and 2 on PIO instance 0
- *  - DMA channels 0 and 1
- *  - 153.6 kBytes of RAM (for pixel color data)
+ *  - PIO state machines 0, 1, and 2 on PIO instance 1
+ *  - Two claimed DMA channels (line transfer and dma_memcpy/dma_memset)
+ *  - 320x240: 2x160 bytes of line buffers and 3x53x30 bytes of text and color buffers (about 5 kBytes)
+ *  - 640x480: 2x320 bytes of line buffers and 3x80x30 bytes of text and color buffers (about 7.7 kBytes)
  *
  *
  *
@@ -30,7 +33,11 @@
 #include "string.h"
 
 #include "vga.h"
+#if VGA_HIRES
+#include "font8x16.h"
+#else
 #include "font.h"
+#endif
 
 #ifdef PICO_RP2350A
 #define SYS_FREQ RP2350_CPU_FREQ
@@ -40,17 +47,28 @@
 
 #include "pio/hsync.pio.h"
 #include "pio/vsync.pio.h"
+#if VGA_HIRES
+#include "pio/rgb_hires.pio.h"
+#else
 #include "pio/rgb.pio.h"
+#endif
 
+#if VGA_HIRES
+// Full 640x480, every line is rendered separately
+#define H_ACTIVE 655   // (active + frontporch - 1) - one cycle delay for mov
+#define V_ACTIVE 479   // (active - 1)
+#define RGB_ACTIVE 319 // (horizontal active)/2 - 1, the PIO outputs two pixels per loop
+#else
 // We are using 640x480 timings but the pixels are doubled both horizontally and vertically to effectively get 320x240
 #define H_ACTIVE 655   // (active + frontporch - 1) - one cycle delay for mov
 #define V_ACTIVE 479   // (active - 1)
 #define RGB_ACTIVE 159 // (horizontal active)/2 - 1
+#endif
 
 // Pixel color arrays that are DMA'd to the PIO machines and
 // pointers to these arrays
-unsigned char vga_data_array1[TXCOUNT];
-unsigned char vga_data_array2[TXCOUNT];
+unsigned char vga_data_array1[TXCOUNT] __attribute__((aligned(4)));
+unsigned char vga_data_array2[TXCOUNT] __attribute__((aligned(4)));
 volatile unsigned char *renderBuf = &vga_data_array1[0];
 volatile unsigned char *transmitBuf = &vga_data_array2[0];
 volatile unsigned char *linePtrT;
@@ -83,6 +101,11 @@ volatile int fontLine;
 uint term_lin_no;
 uint cr_x, cr_y;
 
+// Scrolling region (inclusive) and deferred autowrap state
+static uint scroll_top = 0;
+static uint scroll_bottom = TERM_HEIGHT - 1;
+static bool wrap_pending = false;
+
 uint8_t doubling;
 volatile uint8_t fg_col = WHITE;
 volatile uint8_t bg_col = BLACK;
@@ -108,8 +131,19 @@ void VGA_setTextColor(uint8_t color)
 
 void VGA_cursor(int x, int y)
 {
+    if (x < 0)
+        x = 0;
+    else if (x >= TERM_WIDTH)
+        x = TERM_WIDTH - 1;
+
+    if (y < 0)
+        y = 0;
+    else if (y >= TERM_HEIGHT)
+        y = TERM_HEIGHT - 1;
+
     cr_x = x;
     cr_y = y;
+    wrap_pending = false;
 }
 
 void VGA_clear()
@@ -118,26 +152,92 @@ void VGA_clear()
     dma_memset(bgColBuf, 0, sizeof(bgColBuf));
 }
 
-void VGA_scrollUp()
+static void VGA_clearRows(uint first, uint count)
 {
-    for (int i = 1; i < TERM_HEIGHT; i++)
+    dma_memset(termBuf[first], 0, count * TERM_WIDTH);
+    dma_memset(bgColBuf[first], 0, count * TERM_WIDTH);
+}
+
+// Scroll rows top..bottom (inclusive) up by n lines
+void VGA_scrollRegionUp(uint top, uint bottom, uint n)
+{
+    uint rows = bottom - top + 1;
+    if (n > rows)
+        n = rows;
+
+    // Rows are contiguous, and an incrementing copy towards lower addresses is overlap-safe
+    if (n < rows)
     {
-        dma_memcpy(termBuf[i - 1], termBuf[i], TERM_WIDTH);
-        dma_memcpy(fgColBuf[i - 1], fgColBuf[i], TERM_WIDTH);
-        dma_memcpy(bgColBuf[i - 1], bgColBuf[i], TERM_WIDTH);
+        uint len = (rows - n) * TERM_WIDTH;
+        dma_memcpy(termBuf[top], termBuf[top + n], len);
+        dma_memcpy(fgColBuf[top], fgColBuf[top + n], len);
+        dma_memcpy(bgColBuf[top], bgColBuf[top + n], len);
     }
 
-    dma_memset(termBuf[TERM_HEIGHT - 1], 0, TERM_WIDTH);
+    VGA_clearRows(bottom + 1 - n, n);
 }
 
-void VGA_newline()
+// Scroll rows top..bottom (inclusive) down by n lines
+void VGA_scrollRegionDown(uint top, uint bottom, uint n)
 {
+    uint rows = bottom - top + 1;
+    if (n > rows)
+        n = rows;
 
-    if (cr_y < TERM_HEIGHT - 1)
-        cr_y++;
-    else
+    // Copy towards higher addresses one row at a time, starting from the bottom
+    for (int i = bottom; i >= (int)(top + n); i--)
+    {
+        dma_memcpy(termBuf[i], termBuf[i - n], TERM_WIDTH);
+        dma_memcpy(fgColBuf[i], fgColBuf[i - n], TERM_WIDTH);
+        dma_memcpy(bgColBuf[i], bgColBuf[i - n], TERM_WIDTH);
+    }
+
+    VGA_clearRows(top, n);
+}
+
+void VGA_setScrollRegion(uint top, uint bottom)
+{
+    if (bottom >= TERM_HEIGHT)
+        bottom = TERM_HEIGHT - 1;
+    if (top >= bottom)
+    {
+        top = 0;
+        bottom = TERM_HEIGHT - 1;
+    }
+
+    scroll_top = top;
+    scroll_bottom = bottom;
+}
+
+void VGA_getScrollRegion(uint *top, uint *bottom)
+{
+    *top = scroll_top;
+    *bottom = scroll_bottom;
+}
+
+void VGA_scrollUp()
+{
+    VGA_scrollRegionUp(scroll_top, scroll_bottom, 1);
+}
+
+void VGA_newline()
+{
+    wrap_pending = false;
+    if (cr_y == scroll_bottom)
         VGA_scrollUp();
+    else if (cr_y < TERM_HEIGHT - 1)
+        cr_y++;
+}
+
+void VGA_reverseIndex()
+{
+    wrap_pending = false;
+    if (cr_y == scroll_top)
+        VGA_scrollRegionDown(scroll_top, scroll_bottom, 1);
+    else if (cr_y > 0)
+        cr_y--;
 }
+
 void VGA_putc(char c)
 {
     if (c == '\t')
@@ -148,9 +248,13 @@ void VGA_putc(char c)
     else if (c == '\n')
         VGA_newline();
     else if (c == '\r')
+    {
         cr_x = 0;
+        wrap_pending = false;
+    }
     else if (c == '\b')
     {
+        wrap_pending = false;
         if (cr_x == 0)
         {
             cr_x = TERM_WIDTH - 1;
@@ -162,15 +266,22 @@ void VGA_putc(char c)
     }
     else
     {
-        termBuf[cr_y][cr_x] = c;
-        fgColBuf[cr_y][cr_x] = fg_col;
-        bgColBuf[cr_y][cr_x] = bg_col;
-        cr_x++;
-        if (cr_x >= TERM_WIDTH)
+        // Wrap only when the next character arrives, so that writing the
+        // last column doesn't scroll the screen (matches VT100 behaviour)
+        if (wrap_pending)
         {
             VGA_newline();
             cr_x = 0;
         }
+
+        termBuf[cr_y][cr_x] = c;
+        fgColBuf[cr_y][cr_x] = fg_col;
+        bgColBuf[cr_y][cr_x] = bg_col;
+
+        if (cr_x < TERM_WIDTH - 1)
+            cr_x++;
+        else
+            wrap_pending = true;
     }
 }
 
@@ -181,6 +292,84 @@ void VGA_puts(char s[])
         VGA_putc(s[i]);
 }
 
+#if VGA_HIRES
+
+// Font rows expanded to pixel masks: each of the 8 pixels becomes a 3-bit field, two per byte
+static uint32_t fontRowMask[256];
+
+// Color index replicated into every pixel field of a 32-bit word
+static uint32_t colorPattern[8];
+
+static void VGA_initLineTables()
+{
+    for (int b = 0; b < 256; b++)
+    {
+        uint32_t m = 0;
+        for (int px = 0; px < 8; px++)
+            if (b & (0x80 >> px))
+                m |= 0b111 << (8 * (px >> 1) + 3 * (px & 1));
+        fontRowMask[b] = m;
+    }
+
+    for (int c = 0; c < 8; c++)
+        colorPattern[c] = c * 0x09090909;
+}
+
+// Renders the current text line into renderBuf, one 32-bit word per character, and moves to the next line
+static void VGA_renderLine()
+{
+    uint32_t *out = (uint32_t *)renderBuf;
+    const unsigned char *fontRow = font8x16 + fontLine;
+    for (int i = 0; i < TERM_WIDTH; i++)
+    {
+        uint32_t m = fontRowMask[fontRow[(uint8_t)currentLine[i] * FONT_HEIGHT]];
+        out[i] = (colorPattern[currentFgColLine[i] & 7] & m) | (colorPattern[currentBgColLine[i] & 7] & ~m);
+    }
+
+    if (lineno == SCREEN_HEIGHT - 1)
+    {
+        lineno = 0;
+        term_lin_no = 0;
+        fontLine = 0;
+        currentLine = termBuf[0];
+        currentFgColLine = fgColBuf[0];
+        currentBgColLine = bgColBuf[0];
+        return;
+    }
+    lineno++;
+
+    if (fontLine == FONT_HEIGHT - 1)
+    {
+        fontLine = 0;
+        term_lin_no++;
+        currentLine = termBuf[term_lin_no];
+        currentFgColLine = fgColBuf[term_lin_no];
+        currentBgColLine = bgColBuf[term_lin_no];
+    }
+    else
+        fontLine++;
+}
+
+static void VGA_swapLineBuffers()
+{
+    linePtrT = transmitBuf;
+    transmitBuf = renderBuf;
+    renderBuf = linePtrT;
+}
+
+void dma_handler()
+{
+    dma_hw->ints0 = 1u << rgb_chan_0;
+
+    // The line rendered during the previous interrupt goes out now,
+    // and the next one is rendered while it is being sent
+    VGA_swapLineBuffers();
+    dma_channel_set_read_addr(rgb_chan_0, transmitBuf, true);
+    VGA_renderLine();
+}
+
+#else
+
 void dma_handler()
 {
     dma_hw->ints0 = 1u << rgb_chan_0;
@@ -241,6 +430,8 @@ void dma_handler()
     }
 }
 
+#endif
+
 void VGA_initDisplay(uint vsync_pin, uint hsync_pin, uint r_pin)
 {
 
@@ -256,7 +447,11 @@ void VGA_initDisplay(uint vsync_pin, uint hsync_pin, uint r_pin)
     // and is of the form <program name_program>
     uint hsync_offset = pio_add_program(pio, &hsync_program);
     uint vsync_offset = pio_add_program(pio, &vsync_program);
+#if VGA_HIRES
+    uint rgb_offset = pio_add_program(pio, &rgb_hires_program);
+#else
     uint rgb_offset = pio_add_program(pio, &rgb_program);
+#endif
 
     // Call the initialization functions that are defined within each PIO file.
     // Why not create these programs here? By putting the initialization function in
@@ -264,7 +459,17 @@ void VGA_initDisplay(uint vsync_pin, uint hsync_pin, uint r_pin)
     // is consolidated in one place. Here in the C, we then just import and use it.
     hsync_program_init(pio, hsync_sm, hsync_offset, hsync_pin);
     vsync_program_init(pio, vsync_sm, vsync_offset, vsync_pin);
+#if VGA_HIRES
+    rgb_hires_program_init(pio, rgb_sm, rgb_offset, r_pin);
+
+    // Line 0 is sent as soon as the DMA starts, line 1 is ready for the first interrupt
+    VGA_initLineTables();
+    VGA_renderLine();
+    VGA_swapLineBuffers();
+    VGA_renderLine();
+#else
     rgb_program_init(pio, rgb_sm, rgb_offset, r_pin);
+#endif
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////
     // ===========================-== DMA Data Channels =================================================
@@ -278,7 +483,11 @@ void VGA_initDisplay(uint vsync_pin, uint hsync_pin, uint r_pin)
 
     // Channel Zero (sends color data to PIO VGA machine)
     dma_channel_config c0 = dma_channel_get_default_config(rgb_chan_0); // default configs
-    channel_config_set_transfer_data_size(&c0, DMA_SIZE_8);             // 8-bit txfers
+#if VGA_HIRES
+    channel_config_set_transfer_data_size(&c0, DMA_SIZE_32); // 32-bit txfers, 8 pixels each
+#else
+    channel_config_set_transfer_data_size(&c0, DMA_SIZE_8); // 8-bit txfers
+#endif
     channel_config_set_read_increment(&c0, true);                       // yes read incrementing
     channel_config_set_write_increment(&c0, false);                     // no write incrementing
     if (pio == pio0)
@@ -290,9 +499,13 @@ void VGA_initDisplay(uint vsync_pin, uint hsync_pin, uint r_pin)
         rgb_chan_0,        // Channel to be configured
         &c0,               // The configuration we just created
         &pio->txf[rgb_sm], // write address (RGB PIO TX FIFO)
-        &transmitBuf,      // The initial read address (pixel color array)
-        TXCOUNT,           // Number of transfers; in this case each is 1 byte.
-        false              // Don't start immediately.
+        transmitBuf,       // The initial read address (pixel color array)
+#if VGA_HIRES
+        TXCOUNT / 4, // Number of transfers; in this case each is 4 bytes.
+#else
+        TXCOUNT, // Number of transfers; in this case each is 1 byte.
+#endif
+        false // Don't start immediately.
     );
 
     // Tell the DMA to raise IRQ line 0 when the channel finishes a block
@@ -300,6 +513,10 @@ void VGA_initDisplay(uint vsync_pin, uint hsync_pin, uint r_pin)
 
     // Configure the processor to run dma_handler() when DMA IRQ 0 is asserted
     irq_set_exclusive_handler(DMA_IRQ_0, dma_handler);
+#if VGA_HIRES
+    // A new line has to be rendered every 31.7us, don't let other interrupts delay it
+    irq_set_priority(DMA_IRQ_0, PICO_HIGHEST_IRQ_PRIORITY);
+#endif
     irq_set_enabled(DMA_IRQ_0, true);
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -6,8 +6,13 @@
 
 #define VGA_BGR 0
 
+#if VGA_HIRES
+// Length of the pixel array in bytes, sent to the PIO as 32-bit words
+#define TXCOUNT 320 // Total pixels/2 (since we have 2 pixels per byte)
+#else
 // Length of the pixel array, and number of DMA transfers
 #define TXCOUNT 160 // Total pixels/2 (since we have 2 pixels per byte)
+#endif
 
 #if VGA_BGR
 #define BLACK 0b0
@@ -29,14 +34,23 @@
 #define WHITE 7
 #endif
 
+#if VGA_HIRES
+// The 5x7 font from font.h with its rows doubled, see font8x16.h
+#define SCREEN_WIDTH 640
+#define SCREEN_HEIGHT 480
+#define FONT_HEIGHT 16
+#define FONT_WIDTH 8
+#else
 #define SCREEN_WIDTH 320
 #define SCREEN_HEIGHT 240
 #define FONT_HEIGHT 8
 #define FONT_WIDTH 6
+#endif
 #define TERM_WIDTH (SCREEN_WIDTH / FONT_WIDTH)
 #define TERM_HEIGHT (SCREEN_HEIGHT / FONT_HEIGHT)
 
 extern volatile unsigned char termBuf[TERM_HEIGHT][TERM_WIDTH];
+extern volatile uint8_t fgColBuf[TERM_HEIGHT][TERM_WIDTH];
 extern volatile uint8_t bgColBuf[TERM_HEIGHT][TERM_WIDTH];
 
 extern uint cr_x, cr_y;
@@ -54,6 +68,12 @@ void dma_memcpy(void *dest, void *src, size_t num);
 void VGA_cursor(int x, int y);
 void VGA_clear();
 void VGA_putc(char c);
+void VGA_newline();
+void VGA_reverseIndex();
+void VGA_setScrollRegion(uint top, uint bottom);
+void VGA_getScrollRegion(uint *top, uint *bottom);
+void VGA_scrollRegionUp(uint top, uint bottom, uint n);
+void VGA_scrollRegionDown(uint top, uint bottom, uint n);
 void VGA_puts(char s[]);
 
 #endif
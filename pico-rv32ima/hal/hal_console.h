@@ -3,12 +3,16 @@
 #define console_putc(c) console_putc(c)
 #define console_puts(s) console_puts(s)
 
-#define console_available() (!queue_is_empty(&kb_queue))
+// Checked once per instruction batch: an unlocked level read instead of taking the queue's spin lock
+#define console_available() (queue_get_level_unsafe(&kb_queue) != 0)
 #define pwr_button() console_available()
 
 char console_read(void)
 {
     char c;
     queue_try_remove(&kb_queue, &c);
+
+    // The console core may be holding back input until there is room
+    console_doorbell();
     return c;
 }
@@ -1,48 +1,43 @@
 #include <stdint.h>
 #include "hardware/gpio.h"
 #include "hw_config.h"
+#include "spi_bridge.h"
 
-uint8_t spi_tx_data, spi_rx_data;
+#if USB_XFER
+#include "xfer.h"
+#endif
 
-static inline uint8_t bb_spi_xfer_byte(uint8_t tx_data)
-{
-    uint8_t rx_data = 0;
+#if USB_NET
+#include "net.h"
+#endif
 
-    for (int i = 0; i < 8; i++)
-    {
-        // set MOSI
-        gpio_put(BB_SPI_MOSI, tx_data & 0x80);
+#if USB_MSC
+#include "msc_disk.h"
+#endif
 
-        tx_data = tx_data << 1;
+#if IO_BRIDGE
+#include "io_bridge.h"
+#endif
 
-        gpio_put(BB_SPI_SCK, false);
-        sleep_us(BB_SPI_DELAY);
+#if PSRAM_COPROC
+#include "psram_coproc.h"
+#endif
 
-        rx_data = rx_data << 1;
-        if (gpio_get(BB_SPI_MISO))
-            rx_data |= 1;
-
-        gpio_put(BB_SPI_SCK, true);
-        sleep_us(BB_SPI_DELAY);
-    }
-
-    return rx_data;
-}
+uint8_t spi_tx_data, spi_rx_data;
+uint32_t spi_buf_offset;
 
 static inline void custom_csr_write(uint16_t csrno, uint32_t value)
 {
     // 0x180 : chip select register
     if (csrno == 0x180)
     {
-        gpio_put(BB_SPI_CS, !value);
-        sleep_us(BB_SPI_DELAY);
+        gpio_put(SPI_BRIDGE_CS, !value);
     }
 
     // 0x181 : initiate SPI transfer
     else if (csrno == 0x181)
     {
-        // do transfer here
-        spi_rx_data = bb_spi_xfer_byte(spi_tx_data);
+        spi_rx_data = spi_bridge_xfer_byte(spi_tx_data);
     }
 
     // 0x182 : tx data register
@@ -50,12 +45,190 @@ static inline void custom_csr_write(uint16_t csrno, uint32_t value)
     {
         spi_tx_data = value;
     }
+
+    // 0x1A0 : SPI config, bits 0-15: SCK frequency in kHz (0 keeps the current one), 16: CPOL, 17: CPHA
+    else if (csrno == 0x1A0)
+    {
+        spi_bridge_config(value);
+    }
+
+    // 0x1A1 : SPI block buffer byte offset for the data register
+    else if (csrno == 0x1A1)
+    {
+        spi_buf_offset = value;
+    }
+
+    // 0x1A2 : SPI block buffer data, writes 4 bytes and advances the offset by 4
+    else if (csrno == 0x1A2)
+    {
+        spi_bridge_buf_write(spi_buf_offset, value);
+        spi_buf_offset += 4;
+    }
+
+    // 0x1A3 : starts a block transfer of the given length from the start of the buffer
+    else if (csrno == 0x1A3)
+    {
+        spi_bridge_start(value);
+    }
+
+#if IO_BRIDGE
+    // 0x1A8 : I/O bridge, appends a word to the command queue
+    else if (csrno == 0x1A8)
+    {
+        io_bridge_queue(value);
+    }
+
+    // 0x1A9 : I/O bridge doorbell, 0 runs the queued commands as one batch and empties the queue,
+    // otherwise runs that many words from the start of the queue and keeps them
+    else if (csrno == 0x1A9)
+    {
+        io_bridge_doorbell(value);
+    }
+
+    // 0x1AB : I/O bridge queue word position for the data register
+    else if (csrno == 0x1AB)
+    {
+        io_bridge_set_pos(value);
+    }
+
+    // 0x1AC : I/O bridge queue data, writes a word and advances the position by one
+    else if (csrno == 0x1AC)
+    {
+        io_bridge_write(value);
+    }
+#endif
+
+#if USB_XFER
+    // 0x189 : file transfer data, sends 4 bytes (little endian), dropped unless 0x188 shows room for them
+    else if (csrno == 0x189)
+    {
+        xfer_write_word(value);
+    }
+
+    // 0x18A : file transfer data, sends 1 byte, dropped if the buffer is full
+    else if (csrno == 0x18A)
+    {
+        xfer_write_byte(value);
+    }
+#endif
+
+#if USB_NET
+    // 0x192 : network, releases the received frame
+    else if (csrno == 0x192)
+    {
+        net_rx_done();
+    }
+
+    // 0x193 : network, appends 4 bytes to the frame being sent
+    else if (csrno == 0x193)
+    {
+        net_tx_write_word(value);
+    }
+
+    // 0x194 : network, sends the frame with the given length
+    else if (csrno == 0x194)
+    {
+        net_tx_send(value);
+    }
+#endif
+
+#if USB_MSC
+    // 0x198 : writing MSC_BOOT_MAGIC reboots into USB mass storage mode
+    else if (csrno == 0x198)
+    {
+        if (value == MSC_BOOT_MAGIC)
+            msc_reboot();
+    }
+#endif
 }
 
 static inline uint32_t custom_csr_read(uint16_t csrno)
 {
-    // 0x182 : tx data register
+    // 0x183 : rx data register
     if (csrno == 0x183)
         return spi_rx_data;
+
+    // 0x1A0 : SPI config
+    else if (csrno == 0x1A0)
+        return spi_bridge_get_config();
+
+    // 0x1A1 : SPI block buffer byte offset
+    else if (csrno == 0x1A1)
+        return spi_buf_offset;
+
+    // 0x1A2 : SPI block buffer data, reads 4 bytes and advances the offset by 4
+    else if (csrno == 0x1A2)
+    {
+        uint32_t data = spi_bridge_buf_read(spi_buf_offset);
+        spi_buf_offset += 4;
+        return data;
+    }
+
+    // 0x1A3 : SPI block transfer status, bits 0-15: length, 31: busy
+    else if (csrno == 0x1A3)
+        return spi_bridge_status();
+
+#if IO_BRIDGE
+    // 0x1A8 : I/O bridge status, bits 0-15: result words, 30: bad command, 31: busy
+    else if (csrno == 0x1A8)
+        return io_bridge_status();
+
+    // 0x1AA : I/O bridge, reads the next result word
+    else if (csrno == 0x1AA)
+        return io_bridge_result();
+
+    // 0x1AB : I/O bridge queue length in words
+    else if (csrno == 0x1AB)
+        return io_bridge_get_len();
+#endif
+
+#if USB_XFER
+    // 0x188 : file transfer status, bits 0-14: bytes to read, 16-30: free space to write, 31: host connected
+    else if (csrno == 0x188)
+        return xfer_status();
+
+    // 0x189 : file transfer data, receives 4 bytes (little endian), only when at least 4 are waiting
+    else if (csrno == 0x189)
+        return xfer_read_word();
+
+    // 0x18A : file transfer data, receives 1 byte
+    else if (csrno == 0x18A)
+        return xfer_read_byte();
+#endif
+
+#if USB_NET
+    // 0x190 : network status, bits 0-15: length of the received frame (0 if none), 16: can send, 31: link up
+    else if (csrno == 0x190)
+        return net_status();
+
+    // 0x191 : network, reads the next 4 bytes of the received frame
+    else if (csrno == 0x191)
+        return net_rx_read_word();
+#endif
+
+#if PSRAM_VICTIM_LINES
+    // 0x1C0 : PSRAM victim buffer hits
+    else if (csrno == 0x1C0)
+        return psram_victim_hits;
+
+    // 0x1C1 : PSRAM victim buffer lookups
+    else if (csrno == 0x1C1)
+        return psram_victim_lookups;
+#endif
+
+#if PSRAM_SRAM_TIER_PAGES
+    // 0x1C2 : SRAM tier hits, guest cache misses served from SRAM
+    else if (csrno == 0x1C2)
+        return psram_tier_hits;
+
+    // 0x1C3 : SRAM tier lookups
+    else if (csrno == 0x1C3)
+        return psram_tier_lookups;
+
+    // 0x1C4 : SRAM tier page promotions
+    else if (csrno == 0x1C4)
+        return psram_tier_promotions;
+#endif
+
     return 0;
 }
\ No newline at end of file
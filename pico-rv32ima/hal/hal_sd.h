@@ -11,5 +11,15 @@ static inline uint8_t sd_spi_byte(uint8_t b)
     return b;
 }
 
+static inline void sd_spi_read(uint8_t *buf, size_t len)
+{
+    spi_read_blocking(SD_SPI_INST, 0xFF, buf, len);
+}
+
+static inline void sd_spi_write(const uint8_t *buf, size_t len)
+{
+    spi_write_blocking(SD_SPI_INST, buf, len);
+}
+
 #define sd_led_off() gpio_put(PICO_DEFAULT_LED_PIN, 0)
 #define sd_led_on() gpio_put(PICO_DEFAULT_LED_PIN, 1)
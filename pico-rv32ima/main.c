@@ -10,6 +10,19 @@
 #include "hw_config.h"
 #include "tiny-rv32ima.h"
 #include "console.h"
+#include "spi_bridge.h"
+
+#if IO_BRIDGE
+#include "io_bridge.h"
+#endif
+
+#if PSRAM_COPROC
+#include "psram_coproc.h"
+#endif
+
+#if USB_MSC
+#include "msc_disk.h"
+#endif
 
 void core1_entry();
 bool gset_sys_clock_khz(uint32_t freq_khz, bool required);
@@ -53,6 +66,10 @@ int main()
     gpio_set_function(PSRAM_SPI_PIN_RX, GPIO_FUNC_SPI);
     gpio_set_function(PSRAM_SPI_PIN_CK, GPIO_FUNC_SPI);
 
+#if PSRAM_COPROC
+    psram_coproc_init();
+#endif
+
     // SD GPIO and SPI
     gpio_init(SD_SPI_PIN_CS);
     gpio_set_dir(SD_SPI_PIN_CS, GPIO_OUT);
@@ -67,24 +84,27 @@ int main()
     gpio_set_function(SD_SPI_PIN_TX, GPIO_FUNC_SPI);
     gpio_set_function(SD_SPI_PIN_RX, GPIO_FUNC_SPI);
 
-    // Bit-banged SPI
-    gpio_init(BB_SPI_CS);
-    gpio_set_dir(BB_SPI_CS, GPIO_OUT);
-    gpio_put(BB_SPI_CS, true);
+    // Guest SPI bridge
+    spi_bridge_init();
 
-    gpio_init(BB_SPI_SCK);
-    gpio_set_dir(BB_SPI_SCK, GPIO_OUT);
-    gpio_put(BB_SPI_SCK, true);
-
-    gpio_init(BB_SPI_MOSI);
-    gpio_set_dir(BB_SPI_MOSI, GPIO_OUT);
-
-    gpio_init(BB_SPI_MISO);
-    gpio_set_dir(BB_SPI_MISO, GPIO_IN);
+#if IO_BRIDGE
+    // Guest GPIO/I2C/PWM bridge
+    io_bridge_init();
+#endif
 
     // Console init
     console_init();
 
+#if USB_MSC
+    // USB mass storage mode, the emulator is not started
+    if (msc_boot_requested())
+    {
+        msc_init();
+        while (true)
+            console_task();
+    }
+#endif
+
     // Second core bringup
     multicore_reset_core1();
     multicore_fifo_drain();
@@ -0,0 +1,555 @@
+#include "pico/stdlib.h"
+
+#include "hardware/gpio.h"
+#include "hardware/spi.h"
+#include "hardware/sync.h"
+
+#include <string.h>
+
+#include "hw_config.h"
+
+#if PSRAM_COPROC
+
+#include "psram_coproc.h"
+#include "console.h"
+#include "vm_config.h"
+
+// Transactions that only write are captured between select and deselect, then queued for the
+// console core, so cache writebacks don't stall the emulator. A transaction that reads, or
+// doesn't fit in a slot, runs on the emulator core. A read only waits for the queued writes up
+// to the last one it overlaps, the others stay queued behind it. The spin lock gives one core
+// at a time the bus, keeps the queued writes in order, and masks interrupts so chip select
+// never stays low for longer than tCEM.
+typedef struct
+{
+    uint32_t len;
+    uint8_t data[PSRAM_COPROC_SLOT_LEN];
+} psram_slot_t;
+
+static psram_slot_t slots[PSRAM_COPROC_SLOTS];
+static volatile uint32_t slot_head, slot_tail;
+static spin_lock_t *bus_lock;
+
+static inline uint32_t cmd_addr(const uint8_t *d)
+{
+    return (d[1] << 16) | (d[2] << 8) | d[3];
+}
+
+static inline bool is_read(const psram_slot_t *s)
+{
+    return s->len >= 4 && (s->data[0] == PSRAM_CMD_READ || s->data[0] == PSRAM_CMD_FAST_READ);
+}
+
+// Runs the oldest queued transaction, with the bus lock held
+static void run_slot(void)
+{
+    psram_slot_t *s = &slots[slot_tail % PSRAM_COPROC_SLOTS];
+    __mem_fence_acquire();
+
+    gpio_put(PSRAM_SPI_PIN_S1, false);
+    spi_write_blocking(PSRAM_SPI_INST, s->data, s->len);
+    gpio_put(PSRAM_SPI_PIN_S1, true);
+
+    __mem_fence_release();
+    slot_tail = slot_tail + 1;
+}
+
+// Runs the queued transactions up to the last one that may touch [addr, addr + len), with the
+// bus lock held. Anything but a plain write within one PSRAM page counts as touching it.
+static void run_overlapping(uint32_t addr, uint32_t len)
+{
+    uint32_t last = slot_tail;
+    for (uint32_t i = slot_tail; i != slot_head; i++)
+    {
+        psram_slot_t *s = &slots[i % PSRAM_COPROC_SLOTS];
+        uint32_t start = cmd_addr(s->data);
+        uint32_t n = s->len - 4;
+
+        if (s->len <= 4 || s->data[0] != PSRAM_CMD_WRITE || start % PSRAM_PAGE_SIZE + n > PSRAM_PAGE_SIZE ||
+            (start < addr + len && addr < start + n))
+            last = i + 1;
+    }
+
+    while (slot_tail != last)
+        run_slot();
+}
+
+// Emulator core transaction state: interrupts saved while a direct transaction holds the bus,
+// and for a read that went ahead of queued writes, the address it has reached
+static psram_slot_t *cur;
+static bool cur_direct;
+static bool cur_served;
+static bool cur_ahead;
+static uint32_t cur_addr;
+static uint32_t bus_irq;
+
+#if PSRAM_VICTIM_LINES
+// Lines written back by the guest cache, kept so that the miss which usually follows a
+// conflict eviction is served without going to the PSRAM. Written in program order at
+// capture time, so they are never older than the queued writes.
+typedef struct
+{
+    uint32_t addr; // UINT32_MAX when empty
+    uint8_t data[CACHE_LINE_SIZE];
+} psram_victim_t;
+
+static psram_victim_t victims[PSRAM_VICTIM_LINES];
+static uint32_t victim_next;
+
+uint32_t psram_victim_hits, psram_victim_lookups;
+
+// Records a line write, and drops any line a partial write overlaps
+static void victim_record(const psram_slot_t *s)
+{
+    if (s->len < 4 || s->data[0] != PSRAM_CMD_WRITE)
+        return;
+
+    uint32_t addr = cmd_addr(s->data);
+    uint32_t len = s->len - 4;
+    bool line = len == CACHE_LINE_SIZE && !(addr & (CACHE_LINE_SIZE - 1));
+
+    for (int i = 0; i < PSRAM_VICTIM_LINES; i++)
+    {
+        psram_victim_t *v = &victims[i];
+        if (v->addr == UINT32_MAX || v->addr + CACHE_LINE_SIZE <= addr || addr + len <= v->addr)
+            continue;
+
+        if (line)
+        {
+            memcpy(v->data, &s->data[4], CACHE_LINE_SIZE);
+            return;
+        }
+        v->addr = UINT32_MAX;
+    }
+
+    if (line)
+    {
+        psram_victim_t *v = &victims[victim_next++ % PSRAM_VICTIM_LINES];
+        v->addr = addr;
+        memcpy(v->data, &s->data[4], CACHE_LINE_SIZE);
+    }
+}
+
+static void victim_flush(void)
+{
+    for (int i = 0; i < PSRAM_VICTIM_LINES; i++)
+        victims[i].addr = UINT32_MAX;
+}
+
+static bool victim_lookup(uint32_t addr, uint8_t *buf, size_t sz)
+{
+    psram_victim_lookups++;
+
+    for (int i = 0; i < PSRAM_VICTIM_LINES; i++)
+    {
+        psram_victim_t *v = &victims[i];
+        if (v->addr != UINT32_MAX && v->addr <= addr && addr + sz <= v->addr + CACHE_LINE_SIZE)
+        {
+            memcpy(buf, &v->data[addr - v->addr], sz);
+            psram_victim_hits++;
+            return true;
+        }
+    }
+    return false;
+}
+#endif
+
+#if PSRAM_SRAM_TIER_PAGES
+// Guest RAM pages kept whole in SRAM: the first PSRAM_SRAM_TIER_PINNED ones (kernel text and
+// exception vectors) permanently, the others promoted once they miss the guest cache often
+// enough. Reads are served from SRAM, writes go through to the PSRAM as well, so a frame can
+// be dropped or refilled at any time.
+#define TIER_RAM_PAGES (EMULATOR_RAM_MB * 1024 * 1024 / PSRAM_TIER_PAGE_SIZE)
+
+typedef struct
+{
+    uint32_t page; // UINT32_MAX when free
+    uint32_t hits;
+    bool valid;
+    uint8_t data[PSRAM_TIER_PAGE_SIZE];
+} psram_frame_t;
+
+static psram_frame_t frames[PSRAM_SRAM_TIER_PAGES];
+
+// Frame number + 1 of each page (0 when not in the tier), and its misses since it was last promoted
+static uint8_t tier_map[TIER_RAM_PAGES];
+static uint8_t tier_misses[TIER_RAM_PAGES];
+
+uint32_t psram_tier_hits, psram_tier_lookups, psram_tier_promotions;
+
+// Reads a page from the PSRAM once the queued writes to it have gone out
+static void tier_fill(psram_frame_t *f)
+{
+    uint32_t irq = spin_lock_blocking(bus_lock);
+    run_overlapping(f->page * PSRAM_TIER_PAGE_SIZE, PSRAM_TIER_PAGE_SIZE);
+    spin_unlock(bus_lock, irq);
+
+    // Short bursts, chip select can't stay low for a whole PSRAM page. The writes left in the
+    // queue don't touch the page, the console core can run them in between.
+    for (uint32_t off = 0; off < PSRAM_TIER_PAGE_SIZE; off += PSRAM_BURST_LEN)
+    {
+        uint32_t addr = f->page * PSRAM_TIER_PAGE_SIZE + off;
+        uint8_t cmd[5] = {PSRAM_CMD_FAST_READ, addr >> 16, addr >> 8, addr, 0};
+
+        irq = spin_lock_blocking(bus_lock);
+        gpio_put(PSRAM_SPI_PIN_S1, false);
+        spi_write_blocking(PSRAM_SPI_INST, cmd, sizeof(cmd));
+        spi_read_blocking(PSRAM_SPI_INST, 0, &f->data[off], PSRAM_BURST_LEN);
+        gpio_put(PSRAM_SPI_PIN_S1, true);
+        spin_unlock(bus_lock, irq);
+    }
+
+    f->valid = true;
+}
+
+// Gives a page a free frame, or the one of the least hit promoted page if that one is now
+// colder than the page. Returns frame + 1, 0 if none.
+static uint32_t tier_promote(uint32_t page)
+{
+    psram_frame_t *f = NULL;
+    for (int i = PSRAM_SRAM_TIER_PINNED; i < PSRAM_SRAM_TIER_PAGES; i++)
+    {
+        if (frames[i].page == UINT32_MAX)
+        {
+            f = &frames[i];
+            break;
+        }
+        if (!f || frames[i].hits < f->hits)
+            f = &frames[i];
+    }
+    if (!f)
+        return 0;
+
+    if (f->page != UINT32_MAX)
+    {
+        // Age the promoted pages, so the ones that were hot long ago can be replaced later
+        bool keep = f->hits >= PSRAM_SRAM_TIER_PROMOTE;
+        for (int i = PSRAM_SRAM_TIER_PINNED; i < PSRAM_SRAM_TIER_PAGES; i++)
+            frames[i].hits >>= 1;
+        if (keep)
+            return 0;
+
+        tier_map[f->page] = 0;
+        tier_misses[f->page] = 0;
+    }
+
+    uint32_t n = f - frames + 1;
+    f->page = page;
+    f->hits = 0;
+    f->valid = false;
+    tier_map[page] = n;
+    psram_tier_promotions++;
+    return n;
+}
+
+static bool tier_lookup(uint32_t addr, uint8_t *buf, size_t sz)
+{
+    uint32_t page = addr / PSRAM_TIER_PAGE_SIZE;
+    if (page >= TIER_RAM_PAGES || (addr + sz - 1) / PSRAM_TIER_PAGE_SIZE != page)
+        return false;
+
+    psram_tier_lookups++;
+
+    uint32_t n = tier_map[page];
+    if (!n)
+    {
+        if (tier_misses[page] < PSRAM_SRAM_TIER_PROMOTE - 1)
+        {
+            tier_misses[page]++;
+            return false;
+        }
+        tier_misses[page] = 0;
+        if (!(n = tier_promote(page)))
+            return false;
+    }
+
+    psram_frame_t *f = &frames[n - 1];
+    if (!f->valid)
+        tier_fill(f);
+
+    memcpy(buf, &f->data[addr % PSRAM_TIER_PAGE_SIZE], sz);
+    f->hits++;
+    psram_tier_hits++;
+    return true;
+}
+
+// Applies a write to the pages it overlaps
+static void tier_write(uint32_t addr, const uint8_t *data, uint32_t n)
+{
+    uint32_t end = addr + n;
+
+    for (uint32_t page = addr / PSRAM_TIER_PAGE_SIZE; n && page <= (end - 1) / PSRAM_TIER_PAGE_SIZE; page++)
+    {
+        if (page >= TIER_RAM_PAGES || !tier_map[page])
+            continue;
+
+        psram_frame_t *f = &frames[tier_map[page] - 1];
+        if (!f->valid)
+            continue;
+
+        uint32_t base = page * PSRAM_TIER_PAGE_SIZE;
+        uint32_t from = addr > base ? addr : base;
+        uint32_t to = end < base + PSRAM_TIER_PAGE_SIZE ? end : base + PSRAM_TIER_PAGE_SIZE;
+        memcpy(&f->data[from - base], &data[from - addr], to - from);
+    }
+}
+
+static void tier_record(const psram_slot_t *s)
+{
+    if (s->len > 4 && s->data[0] == PSRAM_CMD_WRITE)
+        tier_write(cmd_addr(s->data), &s->data[4], s->len - 4);
+}
+
+// Address reached by a large write running on the emulator core
+static uint32_t tier_waddr;
+static bool tier_wtrack;
+
+// Refills every page on its next read
+static void tier_flush(void)
+{
+    for (int i = 0; i < PSRAM_SRAM_TIER_PAGES; i++)
+        frames[i].valid = false;
+}
+#endif
+
+// Turns the captured transaction into one that runs right here. A read of sz bytes goes ahead of
+// the queued writes it doesn't overlap, anything else waits for the whole queue.
+static void go_direct(size_t sz)
+{
+    bus_irq = spin_lock_blocking(bus_lock);
+    if (sz && is_read(cur))
+    {
+        cur_addr = cmd_addr(cur->data);
+        run_overlapping(cur_addr, sz);
+        cur_ahead = slot_tail != slot_head;
+    }
+    else
+    {
+        while (slot_tail != slot_head)
+            run_slot();
+    }
+
+#if PSRAM_VICTIM_LINES
+    // Large writes bypass the capture, don't track what they overlap. Without a captured
+    // command, this is a write that came in one buffer with its command.
+    if (!cur->len || cur->data[0] == PSRAM_CMD_WRITE)
+        victim_flush();
+#endif
+
+#if PSRAM_SRAM_TIER_PAGES
+    // The SRAM tier follows large writes as they go out, or refills if their address is unknown
+    tier_wtrack = cur->len >= 4 && cur->data[0] == PSRAM_CMD_WRITE;
+    if (tier_wtrack)
+    {
+        tier_waddr = cmd_addr(cur->data);
+        tier_record(cur);
+        tier_waddr += cur->len - 4;
+    }
+    else if (!cur->len)
+        tier_flush();
+#endif
+
+    gpio_put(PSRAM_SPI_PIN_S1, false);
+    if (cur->len)
+        spi_write_blocking(PSRAM_SPI_INST, cur->data, cur->len);
+    cur_direct = true;
+}
+
+// A read that went ahead of queued writes continues past the range it was checked for: ends the
+// burst, runs the rest of the queue, and carries on with a new command at the next address
+static void read_rejoin(void)
+{
+    gpio_put(PSRAM_SPI_PIN_S1, true);
+    while (slot_tail != slot_head)
+        run_slot();
+    cur_ahead = false;
+
+    uint8_t cmd[5] = {cur->data[0], cur_addr >> 16, cur_addr >> 8, cur_addr, 0};
+    gpio_put(PSRAM_SPI_PIN_S1, false);
+    spi_write_blocking(PSRAM_SPI_INST, cmd, cmd[0] == PSRAM_CMD_FAST_READ ? 5 : 4);
+}
+
+#if PSRAM_WRITE_COMBINE
+// Appends a write to the last queued one when it continues it in the same PSRAM page, so
+// streaming writebacks (page zeroing, memset) cost one command per burst instead of per line
+static bool write_combine(const psram_slot_t *s)
+{
+    if (s->len <= 4 || s->data[0] != PSRAM_CMD_WRITE)
+        return false;
+
+    bool done = false;
+    uint32_t addr = cmd_addr(s->data);
+    uint32_t n = s->len - 4;
+
+    // Under the lock, the last queued slot can't be running
+    uint32_t irq = spin_lock_blocking(bus_lock);
+    if (slot_head != slot_tail)
+    {
+        psram_slot_t *p = &slots[(slot_head - 1) % PSRAM_COPROC_SLOTS];
+        uint32_t start = cmd_addr(p->data);
+
+        if (p->len > 4 && p->data[0] == PSRAM_CMD_WRITE && start + p->len - 4 == addr &&
+            p->len - 4 + n <= PSRAM_BURST_LEN && start / PSRAM_PAGE_SIZE == (addr + n - 1) / PSRAM_PAGE_SIZE)
+        {
+            memcpy(&p->data[p->len], &s->data[4], n);
+            p->len += n;
+            done = true;
+        }
+    }
+    spin_unlock(bus_lock, irq);
+
+    return done;
+}
+#endif
+
+void psram_coproc_init(void)
+{
+    bus_lock = spin_lock_init(spin_lock_claim_unused(true));
+
+#if PSRAM_VICTIM_LINES
+    victim_flush();
+#endif
+
+#if PSRAM_SRAM_TIER_PAGES
+    for (int i = 0; i < PSRAM_SRAM_TIER_PAGES; i++)
+        frames[i].page = UINT32_MAX;
+
+    // Pinned pages are read on their first miss
+    for (int i = 0; i < PSRAM_SRAM_TIER_PINNED; i++)
+    {
+        frames[i].page = i;
+        tier_map[i] = i + 1;
+    }
+#endif
+}
+
+void psram_coproc_task(void)
+{
+    while (slot_tail != slot_head)
+    {
+        uint32_t irq = spin_lock_blocking(bus_lock);
+        if (slot_tail != slot_head)
+            run_slot();
+        spin_unlock(bus_lock, irq);
+    }
+}
+
+void psram_coproc_select(void)
+{
+    // Queue full: run the oldest transaction instead of waiting for the console core
+    if (slot_head - slot_tail == PSRAM_COPROC_SLOTS)
+    {
+        uint32_t irq = spin_lock_blocking(bus_lock);
+        if (slot_head - slot_tail == PSRAM_COPROC_SLOTS)
+            run_slot();
+        spin_unlock(bus_lock, irq);
+    }
+
+    cur = &slots[slot_head % PSRAM_COPROC_SLOTS];
+    cur->len = 0;
+    cur_direct = false;
+    cur_served = false;
+    cur_ahead = false;
+}
+
+void psram_coproc_deselect(void)
+{
+    if (cur_direct)
+    {
+        gpio_put(PSRAM_SPI_PIN_S1, true);
+        spin_unlock(bus_lock, bus_irq);
+        return;
+    }
+
+    // Read served from SRAM, nothing to send
+    if (cur_served)
+        return;
+
+#if PSRAM_SRAM_TIER_PAGES
+    tier_record(cur);
+#endif
+
+#if PSRAM_VICTIM_LINES
+    victim_record(cur);
+#endif
+
+#if PSRAM_WRITE_COMBINE
+    if (write_combine(cur))
+        return;
+#endif
+
+    __mem_fence_release();
+    slot_head = slot_head + 1;
+    console_doorbell();
+}
+
+void psram_coproc_write(const uint8_t *buf, size_t sz)
+{
+    if (!cur_direct && cur->len + sz > PSRAM_COPROC_SLOT_LEN)
+        go_direct(0);
+
+    if (cur_direct)
+    {
+        spi_write_blocking(PSRAM_SPI_INST, buf, sz);
+#if PSRAM_SRAM_TIER_PAGES
+        if (tier_wtrack)
+        {
+            tier_write(tier_waddr, buf, sz);
+            tier_waddr += sz;
+        }
+#endif
+    }
+    else
+    {
+        memcpy(&cur->data[cur->len], buf, sz);
+        cur->len += sz;
+    }
+}
+
+// Serves a read from SRAM if it can
+static bool sram_lookup(uint32_t addr, uint8_t *buf, size_t sz)
+{
+#if PSRAM_SRAM_TIER_PAGES
+    if (tier_lookup(addr, buf, sz))
+        return true;
+#endif
+
+#if PSRAM_VICTIM_LINES
+    if (victim_lookup(addr, buf, sz))
+        return true;
+#endif
+
+    return false;
+}
+
+void psram_coproc_read(uint8_t *buf, size_t sz)
+{
+    if (!cur_direct && is_read(cur))
+    {
+        // A later read of the same transaction carries on where the last one stopped
+        if (!cur_served)
+            cur_addr = cmd_addr(cur->data);
+
+        if (sram_lookup(cur_addr, buf, sz))
+        {
+            cur_served = true;
+            cur_addr += sz;
+            return;
+        }
+
+        // The PSRAM read starts after the part already served from SRAM
+        cur->data[1] = cur_addr >> 16;
+        cur->data[2] = cur_addr >> 8;
+        cur->data[3] = cur_addr;
+    }
+
+    if (!cur_direct)
+        go_direct(sz);
+    else if (cur_ahead)
+        read_rejoin();
+
+    spi_read_blocking(PSRAM_SPI_INST, 0, buf, sz);
+    cur_addr += sz;
+}
+
+#endif
@@ -0,0 +1,52 @@
+#ifndef _PSRAM_COPROC_H
+#define _PSRAM_COPROC_H
+
+#include "hw_config.h"
+#if PSRAM_COPROC
+
+#include <stdint.h>
+#include <stddef.h>
+
+// Queued write transactions, and the largest one (command, address and data)
+#define PSRAM_COPROC_SLOTS 16
+#define PSRAM_COPROC_SLOT_LEN 68
+
+// PSRAM commands seen in the captured transactions
+#define PSRAM_CMD_WRITE 0x02
+#define PSRAM_CMD_READ 0x03
+#define PSRAM_CMD_FAST_READ 0x0B
+
+// Bursts wrap at the page boundary
+#define PSRAM_PAGE_SIZE 1024
+
+// Longest burst built here (combined writes, SRAM tier fills): chip select must not stay low for
+// more than tCEM (8 us), 37 bytes with the command take about 6 us at the 50 MHz bus clock
+#define PSRAM_BURST_LEN 32
+
+#if PSRAM_SRAM_TIER_PAGES
+// SRAM tier page size, the guest MMU page
+#define PSRAM_TIER_PAGE_SIZE 4096
+
+// SRAM tier reads served, reads looked up and pages promoted
+extern uint32_t psram_tier_hits, psram_tier_lookups, psram_tier_promotions;
+#endif
+
+#if PSRAM_VICTIM_LINES
+// Victim buffer hits and lookups
+extern uint32_t psram_victim_hits, psram_victim_lookups;
+#endif
+
+void psram_coproc_init(void);
+
+// Console core: runs the queued write transactions
+void psram_coproc_task(void);
+
+// Emulator core, behind the hal_psram.h interface
+void psram_coproc_select(void);
+void psram_coproc_deselect(void);
+void psram_coproc_write(const uint8_t *buf, size_t sz);
+void psram_coproc_read(uint8_t *buf, size_t sz);
+
+#endif
+
+#endif
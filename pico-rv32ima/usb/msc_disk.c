@@ -0,0 +1,473 @@
+#include "pico/stdlib.h"
+#include "hardware/watchdog.h"
+
+#include <string.h>
+
+#include "hw_config.h"
+
+#if USB_MSC
+
+#include "tusb.h"
+#include "hal_sd.h"
+#include "console.h"
+#include "msc_disk.h"
+
+#define SD_SECTOR 512
+
+// Sectors moved per USB callback, also the size of the read-ahead buffer
+#define MSC_BUF_SECTORS (CFG_TUD_MSC_EP_BUFSIZE / SD_SECTOR)
+
+// An open multi-block transfer is ended after this long without USB traffic
+#define MSC_IDLE_US 100000
+
+// SPI clock once the card is initialized
+#define MSC_SD_FREQ (25 * 1000 * 1000)
+
+// SD commands, ACMDs are prefixed with CMD55
+#define CMD0 0
+#define CMD1 1
+#define CMD8 8
+#define CMD9 9
+#define CMD12 12
+#define CMD16 16
+#define CMD18 18
+#define CMD25 25
+#define CMD55 55
+#define CMD58 58
+#define ACMD41 (0x80 | 41)
+
+// Data tokens
+#define TOKEN_START_BLOCK 0xFE
+#define TOKEN_START_MULTI_WRITE 0xFC
+#define TOKEN_STOP_TRAN 0xFD
+
+enum
+{
+    SD_STREAM_NONE,
+    SD_STREAM_READ,
+    SD_STREAM_WRITE,
+};
+
+static bool msc_active;
+static bool sd_ready;
+static bool sd_block_addr; // SDHC/SDXC cards are addressed in sectors, older ones in bytes
+static uint32_t sd_sectors;
+
+// Open CMD18 / CMD25 transfer, and the sector it continues with
+static int sd_stream;
+static uint32_t sd_stream_lba;
+static uint32_t sd_last_use;
+
+// Sectors already read from an open CMD18 transfer, ahead of the host
+static uint8_t ra_buf[MSC_BUF_SECTORS * SD_SECTOR] __attribute__((aligned(4)));
+static uint32_t ra_lba;
+static uint32_t ra_count;
+
+static bool sd_wait_ready(uint32_t timeout_ms)
+{
+    absolute_time_t t = make_timeout_time_ms(timeout_ms);
+    while (sd_spi_byte(0xFF) != 0xFF)
+        if (time_reached(t))
+            return false;
+    return true;
+}
+
+static uint8_t sd_send_cmd(uint8_t cmd, uint32_t arg)
+{
+    uint8_t r;
+
+    if (cmd & 0x80)
+    {
+        cmd &= 0x7F;
+        r = sd_send_cmd(CMD55, 0);
+        if (r > 1)
+            return r;
+    }
+
+    // CMD12 interrupts a read transfer, the card isn't ready at this point
+    if (cmd != CMD12)
+    {
+        sd_deselect();
+        sd_spi_byte(0xFF);
+        sd_select();
+        if (!sd_wait_ready(500))
+            return 0xFF;
+    }
+
+    sd_spi_byte(0x40 | cmd);
+    sd_spi_byte(arg >> 24);
+    sd_spi_byte(arg >> 16);
+    sd_spi_byte(arg >> 8);
+    sd_spi_byte(arg);
+    sd_spi_byte(cmd == CMD0 ? 0x95 : cmd == CMD8 ? 0x87
+                                                 : 0x01);
+
+    // Stuff byte
+    if (cmd == CMD12)
+        sd_spi_byte(0xFF);
+
+    int n = 10;
+    do
+        r = sd_spi_byte(0xFF);
+    while ((r & 0x80) && --n);
+
+    return r;
+}
+
+static bool sd_read_block(uint8_t *buf, uint32_t len)
+{
+    absolute_time_t t = make_timeout_time_ms(200);
+    uint8_t token;
+    while ((token = sd_spi_byte(0xFF)) == 0xFF)
+        if (time_reached(t))
+            return false;
+
+    if (token != TOKEN_START_BLOCK)
+        return false;
+
+    sd_spi_read(buf, len);
+
+    // CRC
+    sd_spi_byte(0xFF);
+    sd_spi_byte(0xFF);
+    return true;
+}
+
+static bool sd_card_init(void)
+{
+    uint8_t ocr[4], csd[16];
+
+    spi_set_baudrate(SD_SPI_INST, 400 * 1000);
+    sd_deselect();
+    for (int i = 0; i < 10; i++)
+        sd_spi_byte(0xFF);
+
+    bool ok = false;
+    absolute_time_t t = make_timeout_time_ms(1000);
+
+    if (sd_send_cmd(CMD0, 0) == 1)
+    {
+        if (sd_send_cmd(CMD8, 0x1AA) == 1)
+        {
+            // SDv2
+            sd_spi_read(ocr, 4);
+            if (ocr[2] == 0x01 && ocr[3] == 0xAA)
+            {
+                while (sd_send_cmd(ACMD41, 1UL << 30) && !time_reached(t))
+                    ;
+                if (!time_reached(t) && sd_send_cmd(CMD58, 0) == 0)
+                {
+                    sd_spi_read(ocr, 4);
+                    sd_block_addr = ocr[0] & 0x40;
+                    ok = true;
+                }
+            }
+        }
+        else
+        {
+            // SDv1 or MMC
+            uint8_t cmd = sd_send_cmd(ACMD41, 0) <= 1 ? ACMD41 : CMD1;
+            while (sd_send_cmd(cmd, 0) && !time_reached(t))
+                ;
+            ok = !time_reached(t) && sd_send_cmd(CMD16, SD_SECTOR) == 0;
+            sd_block_addr = false;
+        }
+    }
+
+    if (ok)
+        ok = sd_send_cmd(CMD9, 0) == 0 && sd_read_block(csd, 16);
+
+    if (ok)
+    {
+        if ((csd[0] >> 6) == 1)
+        {
+            // CSD v2
+            uint32_t c_size = ((uint32_t)(csd[7] & 0x3F) << 16) | ((uint32_t)csd[8] << 8) | csd[9];
+            sd_sectors = (c_size + 1) << 10;
+        }
+        else
+        {
+            // CSD v1
+            uint32_t read_bl_len = csd[5] & 0x0F;
+            uint32_t c_size = ((uint32_t)(csd[6] & 0x03) << 10) | ((uint32_t)csd[7] << 2) | (csd[8] >> 6);
+            uint32_t c_size_mult = ((csd[9] & 0x03) << 1) | (csd[10] >> 7);
+            sd_sectors = (c_size + 1) << (c_size_mult + 2 + read_bl_len - 9);
+        }
+    }
+
+    sd_deselect();
+    sd_spi_byte(0xFF);
+
+    spi_set_baudrate(SD_SPI_INST, MSC_SD_FREQ);
+    return ok;
+}
+
+// Ends the open multi-block transfer, if any
+static void sd_stream_stop(void)
+{
+    if (sd_stream == SD_STREAM_READ)
+    {
+        sd_send_cmd(CMD12, 0);
+        sd_wait_ready(500);
+    }
+    else if (sd_stream == SD_STREAM_WRITE)
+    {
+        sd_wait_ready(500);
+        sd_spi_byte(TOKEN_STOP_TRAN);
+        sd_spi_byte(0xFF);
+        sd_wait_ready(500);
+    }
+
+    if (sd_stream != SD_STREAM_NONE)
+    {
+        sd_deselect();
+        sd_spi_byte(0xFF);
+    }
+
+    sd_stream = SD_STREAM_NONE;
+    ra_count = 0;
+}
+
+// Makes sure a transfer of the given kind is open at lba, continuing the current one when possible
+static bool sd_stream_at(int kind, uint32_t lba)
+{
+    if (sd_stream == kind && sd_stream_lba == lba)
+        return true;
+
+    sd_stream_stop();
+
+    uint8_t cmd = kind == SD_STREAM_READ ? CMD18 : CMD25;
+    if (sd_send_cmd(cmd, sd_block_addr ? lba : lba * SD_SECTOR) != 0)
+    {
+        sd_deselect();
+        return false;
+    }
+
+    sd_stream = kind;
+    sd_stream_lba = lba;
+    return true;
+}
+
+static bool sd_stream_read(uint32_t lba, uint8_t *buf, uint32_t count)
+{
+    if (!sd_stream_at(SD_STREAM_READ, lba))
+        return false;
+
+    for (uint32_t i = 0; i < count; i++)
+    {
+        if (!sd_read_block(buf + i * SD_SECTOR, SD_SECTOR))
+        {
+            sd_stream_stop();
+            return false;
+        }
+        sd_stream_lba++;
+    }
+    return true;
+}
+
+static bool sd_stream_write(uint32_t lba, const uint8_t *buf, uint32_t count)
+{
+    if (!sd_stream_at(SD_STREAM_WRITE, lba))
+        return false;
+
+    for (uint32_t i = 0; i < count; i++)
+    {
+        if (!sd_wait_ready(500))
+        {
+            sd_stream_stop();
+            return false;
+        }
+
+        sd_spi_byte(TOKEN_START_MULTI_WRITE);
+        sd_spi_write(buf + i * SD_SECTOR, SD_SECTOR);
+        sd_spi_byte(0xFF);
+        sd_spi_byte(0xFF);
+
+        if ((sd_spi_byte(0xFF) & 0x1F) != 0x05)
+        {
+            sd_stream_stop();
+            return false;
+        }
+        sd_stream_lba++;
+    }
+    return true;
+}
+
+bool msc_boot_requested(void)
+{
+    gpio_init(MSC_BOOT_PIN);
+    gpio_set_dir(MSC_BOOT_PIN, GPIO_IN);
+    gpio_pull_up(MSC_BOOT_PIN);
+    sleep_us(100);
+    bool held = !gpio_get(MSC_BOOT_PIN);
+
+    bool requested = watchdog_hw->scratch[MSC_BOOT_SCRATCH] == MSC_BOOT_MAGIC;
+    watchdog_hw->scratch[MSC_BOOT_SCRATCH] = 0;
+
+    return held || requested;
+}
+
+void msc_reboot(void)
+{
+    watchdog_hw->scratch[MSC_BOOT_SCRATCH] = MSC_BOOT_MAGIC;
+    watchdog_reboot(0, 0, 0);
+    while (true)
+        tight_loop_contents();
+}
+
+void msc_init(void)
+{
+    msc_active = true;
+    sd_ready = sd_card_init();
+
+    if (sd_ready)
+        console_printf("USB mass storage mode, %lu MiB SD card\r\nEject the drive to start the emulator.\r\n", sd_sectors >> 11);
+    else
+        console_printf("USB mass storage mode: SD card init failed!\r\n");
+}
+
+void msc_task(void)
+{
+    if (sd_stream == SD_STREAM_NONE)
+        return;
+
+    // Close the transfer once the host is done with it, so writes reach the flash
+    if (time_us_32() - sd_last_use > MSC_IDLE_US)
+    {
+        sd_stream_stop();
+        return;
+    }
+
+    // Read ahead while the previous chunk is still going out over USB
+    if (sd_stream == SD_STREAM_READ && ra_count == 0 && sd_stream_lba < sd_sectors)
+    {
+        uint32_t count = sd_sectors - sd_stream_lba;
+        if (count > MSC_BUF_SECTORS)
+            count = MSC_BUF_SECTORS;
+
+        uint32_t lba = sd_stream_lba;
+        if (sd_stream_read(lba, ra_buf, count))
+        {
+            ra_lba = lba;
+            ra_count = count;
+        }
+    }
+}
+
+//--------------------------------------------------------------------+
+// TinyUSB MSC callbacks
+//--------------------------------------------------------------------+
+
+void tud_msc_inquiry_cb(uint8_t lun, uint8_t vendor_id[8], uint8_t product_id[16], uint8_t product_rev[4])
+{
+    (void)lun;
+
+    memcpy(vendor_id, "pico    ", 8);
+    memcpy(product_id, "rv32ima SD card ", 16);
+    memcpy(product_rev, "1.0 ", 4);
+}
+
+bool tud_msc_test_unit_ready_cb(uint8_t lun)
+{
+    // The emulator owns the card unless booted into mass storage mode
+    if (!msc_active || !sd_ready)
+    {
+        tud_msc_set_sense(lun, SCSI_SENSE_NOT_READY, 0x3A, 0x00);
+        return false;
+    }
+    return true;
+}
+
+void tud_msc_capacity_cb(uint8_t lun, uint32_t *block_count, uint16_t *block_size)
+{
+    (void)lun;
+
+    *block_count = (msc_active && sd_ready) ? sd_sectors : 0;
+    *block_size = SD_SECTOR;
+}
+
+bool tud_msc_start_stop_cb(uint8_t lun, uint8_t power_condition, bool start, bool load_eject)
+{
+    (void)lun;
+    (void)power_condition;
+
+    // Ejecting the drive restarts into the emulator
+    if (msc_active && load_eject && !start)
+    {
+        sd_stream_stop();
+        watchdog_reboot(0, 0, 10);
+    }
+    return true;
+}
+
+int32_t tud_msc_read10_cb(uint8_t lun, uint32_t lba, uint32_t offset, void *buffer, uint32_t bufsize)
+{
+    (void)lun;
+
+    // CFG_TUD_MSC_EP_BUFSIZE is a multiple of the sector size, so transfers are always sector aligned
+    if (!msc_active || !sd_ready || offset || bufsize % SD_SECTOR)
+        return -1;
+
+    uint8_t *buf = buffer;
+    uint32_t count = bufsize / SD_SECTOR;
+    sd_last_use = time_us_32();
+
+    // Sectors already in the read-ahead buffer
+    if (sd_stream == SD_STREAM_READ && ra_count && ra_lba == lba)
+    {
+        uint32_t n = count < ra_count ? count : ra_count;
+        memcpy(buf, ra_buf, n * SD_SECTOR);
+        if (n < ra_count)
+            memmove(ra_buf, ra_buf + n * SD_SECTOR, (ra_count - n) * SD_SECTOR);
+        ra_lba += n;
+        ra_count -= n;
+        lba += n;
+        buf += n * SD_SECTOR;
+        count -= n;
+    }
+    else
+        ra_count = 0;
+
+    if (count && !sd_stream_read(lba, buf, count))
+        return -1;
+
+    return bufsize;
+}
+
+int32_t tud_msc_write10_cb(uint8_t lun, uint32_t lba, uint32_t offset, uint8_t *buffer, uint32_t bufsize)
+{
+    (void)lun;
+
+    if (!msc_active || !sd_ready || offset || bufsize % SD_SECTOR)
+        return -1;
+
+    // Consecutive writes continue the same CMD25 transfer
+    sd_last_use = time_us_32();
+    if (!sd_stream_write(lba, buffer, bufsize / SD_SECTOR))
+        return -1;
+
+    return bufsize;
+}
+
+int32_t tud_msc_scsi_cb(uint8_t lun, uint8_t const scsi_cmd[16], void *buffer, uint16_t bufsize)
+{
+    (void)buffer;
+    (void)bufsize;
+
+    switch (scsi_cmd[0])
+    {
+    case SCSI_CMD_PREVENT_ALLOW_MEDIUM_REMOVAL:
+        return 0;
+
+    // SYNCHRONIZE CACHE (10)
+    case 0x35:
+        sd_stream_stop();
+        return 0;
+
+    default:
+        tud_msc_set_sense(lun, SCSI_SENSE_ILLEGAL_REQUEST, 0x20, 0x00);
+        return -1;
+    }
+}
+
+#endif
@@ -0,0 +1,27 @@
+#ifndef _MSC_DISK_H
+#define _MSC_DISK_H
+
+#include "hw_config.h"
+#if USB_MSC
+
+#include <stdbool.h>
+
+// watchdog scratch register and value used to request the USB mass storage mode across a reboot
+#define MSC_BOOT_SCRATCH 0
+#define MSC_BOOT_MAGIC 0x4D534321
+
+// Checks the boot button and the guest request, clears the request
+bool msc_boot_requested(void);
+
+// Brings up the SD card and exposes it over USB, the VM must not be started afterwards
+void msc_init(void);
+
+// Console core: prefetches and flushes the SD card streams
+void msc_task(void);
+
+// Reboots into USB mass storage mode, callable from either core
+void msc_reboot(void);
+
+#endif
+
+#endif
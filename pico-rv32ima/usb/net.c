@@ -0,0 +1,185 @@
+#include "hw_config.h"
+
+#if USB_NET
+
+#include "pico/stdlib.h"
+#include "tusb.h"
+
+#include "net.h"
+#include "console.h"
+
+// Frame slots shared between the two cores. Each ring has one producer and one consumer.
+typedef struct
+{
+    uint8_t data[(NET_FRAME_LEN + 3) & ~3] __attribute__((aligned(4)));
+    uint16_t len;
+} net_frame_t;
+
+static net_frame_t tx_frames[NET_TX_SLOTS];
+
+// Host to guest: the guest reads the frame straight out of the USB stack's receive buffer. The
+// console core publishes it through rx_head, the emulator core hands it back through rx_tail
+// and owns the read offset. Until then the frame is left unaccepted, so the stack keeps it and
+// offers it again, and it is accepted on that offer.
+static const uint8_t *rx_data;
+static uint16_t rx_len;
+static volatile uint32_t rx_head, rx_tail;
+static uint32_t rx_offset;
+
+// Console core: the frame published to the guest, and a frame is waiting to be offered again
+static bool rx_held;
+static bool rx_wait;
+
+// Guest to host: written by the emulator core, read by the console core
+static volatile uint32_t tx_head, tx_tail;
+static uint32_t tx_offset;
+
+static volatile bool link_up;
+
+// MAC address used by the host side of the link; the guest picks its own
+uint8_t tud_network_mac_address[6] = {0x02, 0x02, 0x84, 0x6A, 0x96, 0x00};
+
+// The stack dropped its buffers: a frame still with the guest is no longer the one it would offer
+void tud_network_init_cb(void)
+{
+    rx_held = false;
+    rx_wait = true;
+}
+
+bool tud_network_recv_cb(const uint8_t *src, uint16_t size)
+{
+    uint32_t head = rx_head;
+    bool idle = head == rx_tail;
+
+    // The published frame, offered again after the guest handed it back
+    if (rx_held && idle)
+    {
+        rx_held = false;
+        return true;
+    }
+
+    // Asked for again from net_task()
+    rx_wait = true;
+
+    if (size > NET_FRAME_LEN)
+        return true; // drop it
+    if (!idle)
+        return false;
+
+    rx_data = src;
+    rx_len = size;
+    rx_held = true;
+
+    __mem_fence_release();
+    rx_head = head + 1;
+    return false;
+}
+
+uint16_t tud_network_xmit_cb(uint8_t *dst, void *ref, uint16_t arg)
+{
+    net_frame_t *f = ref;
+    memcpy(dst, f->data, arg);
+    return arg;
+}
+
+void net_task(void)
+{
+    link_up = tud_ready();
+
+    // Once the guest is done: the first offer gives the frame back, the second brings the next one
+    if (rx_wait && rx_head == rx_tail)
+    {
+        rx_wait = false;
+        tud_network_recv_renew();
+        if (!rx_held)
+            tud_network_recv_renew();
+    }
+
+    uint32_t tail = tx_tail;
+    if (tail != tx_head)
+    {
+        __mem_fence_acquire();
+        net_frame_t *f = &tx_frames[tail % NET_TX_SLOTS];
+
+        // Frames queued while the host isn't listening are dropped
+        if (link_up && !tud_network_can_xmit(f->len))
+            return;
+        if (link_up)
+            tud_network_xmit(f, f->len);
+
+        __mem_fence_release();
+        tx_tail = tail + 1;
+    }
+}
+
+uint32_t net_status(void)
+{
+    uint32_t status = link_up ? NET_STATUS_LINK : 0;
+
+    if (rx_head != rx_tail)
+    {
+        __mem_fence_acquire();
+        status |= rx_len;
+    }
+
+    if (tx_head - tx_tail < NET_TX_SLOTS)
+        status |= NET_STATUS_TX_READY;
+
+    return status;
+}
+
+// Reads the frame waiting for the guest, 4 bytes at a time
+uint32_t net_rx_read_word(void)
+{
+    if (rx_head == rx_tail)
+        return 0;
+    __mem_fence_acquire();
+
+    if (rx_offset >= rx_len)
+        return 0;
+
+    // Not past the end of the frame, the stack's buffer may end there
+    uint32_t w = 0;
+    uint32_t n = rx_len - rx_offset < 4 ? rx_len - rx_offset : 4;
+    memcpy(&w, &rx_data[rx_offset], n);
+    rx_offset += 4;
+    return w;
+}
+
+// Releases the frame waiting for the guest
+void net_rx_done(void)
+{
+    if (rx_head == rx_tail)
+        return;
+
+    rx_offset = 0;
+    __mem_fence_release();
+    rx_tail = rx_tail + 1;
+    console_doorbell();
+}
+
+void net_tx_write_word(uint32_t w)
+{
+    if (tx_head - tx_tail == NET_TX_SLOTS || tx_offset >= NET_FRAME_LEN)
+        return;
+
+    memcpy(&tx_frames[tx_head % NET_TX_SLOTS].data[tx_offset], &w, 4);
+    tx_offset += 4;
+}
+
+// Queues the frame written so far
+void net_tx_send(uint32_t len)
+{
+    uint32_t head = tx_head;
+    tx_offset = 0;
+
+    if (head - tx_tail == NET_TX_SLOTS || len > NET_FRAME_LEN)
+        return;
+
+    tx_frames[head % NET_TX_SLOTS].len = len;
+    __mem_fence_release();
+    tx_head = head + 1;
+    console_doorbell();
+}
+
+#endif
@@ -0,0 +1,32 @@
+#ifndef _NET_H
+#define _NET_H
+
+#include "hw_config.h"
+#if USB_NET
+
+#include <stdint.h>
+
+// Largest Ethernet frame (without FCS)
+#define NET_FRAME_LEN 1514
+
+// Number of frames buffered from the guest to the host, the other way they stay in the USB stack's buffers
+#define NET_TX_SLOTS 2
+
+// Status word returned by net_status()
+#define NET_STATUS_RX_LEN_MASK 0xFFFF // length of the frame waiting for the guest, 0 if none
+#define NET_STATUS_TX_READY (1u << 16) // a frame can be sent
+#define NET_STATUS_LINK (1u << 31)     // the host has configured the interface
+
+// Console core: passes frames between the NCM function and the guest buffers
+void net_task(void);
+
+// Emulator core
+uint32_t net_status(void);
+uint32_t net_rx_read_word(void);
+void net_rx_done(void);
+void net_tx_write_word(uint32_t w);
+void net_tx_send(uint32_t len);
+
+#endif
+
+#endif
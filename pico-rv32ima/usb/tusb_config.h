@@ -27,6 +27,8 @@
 #ifndef _TUSB_CONFIG_H_
 #define _TUSB_CONFIG_H_
 
+#include "hw_config.h"
+
 #ifdef __cplusplus
 extern "C"
 {
@@ -97,11 +99,12 @@ extern "C"
 #endif
 
 //------------- CLASS -------------//
-#define CFG_TUD_CDC 1
-#define CFG_TUD_MSC 0
+#define CFG_TUD_CDC (1 + USB_XFER)
+#define CFG_TUD_MSC USB_MSC
 #define CFG_TUD_HID 0
 #define CFG_TUD_MIDI 0
 #define CFG_TUD_VENDOR 0
+#define CFG_TUD_NCM USB_NET
 
 // CDC FIFO size of TX and RX
 #define CFG_TUD_CDC_RX_BUFSIZE 512
@@ -109,8 +112,8 @@ extern "C"
 
 #define CFG_TUD_CDC_EP_BUFSIZE 512
 
-// MSC Buffer size of Device Mass storage
-#define CFG_TUD_MSC_EP_BUFSIZE 512
+// MSC Buffer size of Device Mass storage, a multiple of the sector size
+#define CFG_TUD_MSC_EP_BUFSIZE 4096
 
 #ifdef __cplusplus
 }
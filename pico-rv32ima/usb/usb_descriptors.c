@@ -35,11 +35,13 @@
  * Same VID/PID with different interface e.g MSC (first), then CDC (later) will possibly cause system error on PC.
  *
  * Auto ProductID layout's Bitmap:
- *   [MSB]         HID | MSC | CDC          [LSB]
+ *   [MSB]  NCM | XFER | VENDOR | MIDI | HID | MSC | CDC  [LSB]
+ *
+ * The file transfer port is a second CDC interface, it gets its own bit instead of raising the CDC count.
  */
-#define _PID_MAP(itf, n) ((CFG_TUD_##itf) << (n))
+#define _PID_MAP(itf, n) ((CFG_TUD_##itf) ? 1 << (n) : 0)
 #define USB_PID (0x4000 | _PID_MAP(CDC, 0) | _PID_MAP(MSC, 1) | _PID_MAP(HID, 2) | \
-                 _PID_MAP(MIDI, 3) | _PID_MAP(VENDOR, 4))
+                 _PID_MAP(MIDI, 3) | _PID_MAP(VENDOR, 4) | (USB_XFER << 5) | _PID_MAP(NCM, 6))
 
 #define USB_VID 0x04c4
 #define USB_BCD 0x0200
@@ -86,6 +88,17 @@ enum
 {
   ITF_NUM_CDC = 0,
   ITF_NUM_CDC_DATA,
+#if USB_XFER
+  ITF_NUM_XFER,
+  ITF_NUM_XFER_DATA,
+#endif
+#if USB_NET
+  ITF_NUM_NET,
+  ITF_NUM_NET_DATA,
+#endif
+#if USB_MSC
+  ITF_NUM_MSC,
+#endif
   ITF_NUM_TOTAL
 };
 
@@ -126,9 +139,23 @@ enum
 #define EPNUM_CDC_OUT 0x01
 #define EPNUM_CDC_IN 0x82
 
+#define EPNUM_XFER_NOTIF 0x83
+#define EPNUM_XFER_OUT 0x04
+#define EPNUM_XFER_IN 0x84
+
+#define EPNUM_NET_NOTIF 0x85
+#define EPNUM_NET_OUT 0x06
+#define EPNUM_NET_IN 0x86
+
+#define EPNUM_MSC_OUT 0x07
+#define EPNUM_MSC_IN 0x87
+
 #endif
 
-#define CONFIG_TOTAL_LEN (TUD_CONFIG_DESC_LEN + TUD_CDC_DESC_LEN)
+#define CONFIG_TOTAL_LEN (TUD_CONFIG_DESC_LEN + (1 + USB_XFER) * TUD_CDC_DESC_LEN + USB_NET * TUD_CDC_NCM_DESC_LEN + USB_MSC * TUD_MSC_DESC_LEN)
+
+// String index of the MAC address, generated from tud_network_mac_address
+#define STRID_MAC 6
 
 // full speed configuration
 uint8_t const desc_fs_configuration[] =
@@ -138,7 +165,22 @@ uint8_t const desc_fs_configuration[] =
 
         // Interface number, string index, EP notification address and size, EP data address (out, in) and size.
         TUD_CDC_DESCRIPTOR(ITF_NUM_CDC, 4, EPNUM_CDC_NOTIF, 8, EPNUM_CDC_OUT, EPNUM_CDC_IN, 64),
-        // Interface number, string index, EP Out & EP In address, EP size
+
+#if USB_XFER
+        // File transfer channel
+        TUD_CDC_DESCRIPTOR(ITF_NUM_XFER, 5, EPNUM_XFER_NOTIF, 8, EPNUM_XFER_OUT, EPNUM_XFER_IN, 64),
+#endif
+
+#if USB_NET
+        // Network interface: interface number, string index, MAC string index, EP notification address and size,
+        // EP data address (out, in) and size, max segment size
+        TUD_CDC_NCM_DESCRIPTOR(ITF_NUM_NET, 7, STRID_MAC, EPNUM_NET_NOTIF, 64, EPNUM_NET_OUT, EPNUM_NET_IN, 64, CFG_TUD_NET_MTU),
+#endif
+
+#if USB_MSC
+        // SD card: interface number, string index, EP out and in address, EP size
+        TUD_MSC_DESCRIPTOR(ITF_NUM_MSC, 8, EPNUM_MSC_OUT, EPNUM_MSC_IN, 64),
+#endif
 };
 
 #if TUD_OPT_HIGH_SPEED
@@ -229,7 +271,12 @@ char const *string_desc_arr[] =
         (const char[]){0x09, 0x04}, // 0: is supported language is English (0x0409)
         "tvlad1234",                // 1: Manufacturer
         "pico-rv32ima",             // 2: Product
-        usb_serial                  // 3: Serials, should use chip ID
+        usb_serial,                 // 3: Serials, should use chip ID
+        "pico-rv32ima console",     // 4: Console CDC interface
+        "pico-rv32ima transfer",    // 5: File transfer CDC interface
+        NULL,                       // 6: MAC address, see STRID_MAC
+        "pico-rv32ima network",     // 7: Network interface
+        "pico-rv32ima SD card",     // 8: Mass storage interface
 };
 
 static uint16_t _desc_str[32];
@@ -240,7 +287,7 @@ uint16_t const *tud_descriptor_string_cb(uint8_t index, uint16_t langid)
 {
   (void)langid;
 
-  uint8_t chr_count;
+  uint8_t chr_count = 0;
 
   usb_serial_init();
 
@@ -249,6 +296,17 @@ uint16_t const *tud_descriptor_string_cb(uint8_t index, uint16_t langid)
     memcpy(&_desc_str[1], string_desc_arr[0], 2);
     chr_count = 1;
   }
+#if USB_NET
+  else if (index == STRID_MAC)
+  {
+    // Hex string of the MAC address, as required by CDC-NCM
+    for (uint8_t i = 0; i < sizeof(tud_network_mac_address); i++)
+    {
+      _desc_str[1 + chr_count++] = "0123456789ABCDEF"[(tud_network_mac_address[i] >> 4) & 0xf];
+      _desc_str[1 + chr_count++] = "0123456789ABCDEF"[(tud_network_mac_address[i] >> 0) & 0xf];
+    }
+  }
+#endif
   else
   {
     // Note: the 0xEE index string is a Microsoft OS 1.0 Descriptors.
@@ -258,6 +316,8 @@ uint16_t const *tud_descriptor_string_cb(uint8_t index, uint16_t langid)
       return NULL;
 
     const char *str = string_desc_arr[index];
+    if (!str)
+      return NULL;
 
     // Cap at max char
     chr_count = strlen(str);
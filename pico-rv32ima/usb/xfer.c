@@ -0,0 +1,173 @@
+#include "hw_config.h"
+
+#if USB_XFER
+
+#include "pico/stdlib.h"
+#include "tusb.h"
+
+#include "xfer.h"
+#include "console.h"
+
+// CDC interface used for file transfers, the console is interface 0
+#define XFER_ITF 1
+
+// Single producer, single consumer rings between the two cores
+typedef struct
+{
+    uint8_t buf[XFER_BUF_LEN];
+    volatile uint32_t head, tail;
+} xfer_ring_t;
+
+static xfer_ring_t host_to_guest, guest_to_host;
+static volatile bool host_connected;
+
+static inline uint32_t ring_level(xfer_ring_t *r)
+{
+    return r->head - r->tail;
+}
+
+// The console core only stops reading from the host when the ring is full, so it is woken once
+// the guest has emptied half of it rather than on every read
+static inline void rx_consumed(uint32_t level, uint32_t n)
+{
+    if (level > XFER_BUF_LEN / 2 && level - n <= XFER_BUF_LEN / 2)
+        console_doorbell();
+}
+
+void xfer_task(void)
+{
+    host_connected = tud_cdc_n_connected(XFER_ITF);
+
+    // Guest to host, in contiguous spans
+    uint32_t tail = guest_to_host.tail;
+    uint32_t count = guest_to_host.head - tail;
+    __mem_fence_acquire();
+
+    while (count)
+    {
+        uint32_t idx = tail & (XFER_BUF_LEN - 1);
+        uint32_t span = XFER_BUF_LEN - idx;
+        if (span > count)
+            span = count;
+
+        // Nobody is listening, drop the data so the guest doesn't stall
+        if (host_connected)
+        {
+            uint32_t avail = tud_cdc_n_write_available(XFER_ITF);
+            if (span > avail)
+                span = avail;
+            if (!span)
+                break;
+            tud_cdc_n_write(XFER_ITF, &guest_to_host.buf[idx], span);
+        }
+
+        tail += span;
+        count -= span;
+    }
+
+    __mem_fence_release();
+    guest_to_host.tail = tail;
+
+    if (host_connected)
+        tud_cdc_n_write_flush(XFER_ITF);
+
+    // Host to guest, only as much as there is room for, the rest is NAKed
+    uint32_t head = host_to_guest.head;
+    uint32_t space = XFER_BUF_LEN - (head - host_to_guest.tail);
+
+    while (space && tud_cdc_n_available(XFER_ITF))
+    {
+        uint32_t idx = head & (XFER_BUF_LEN - 1);
+        uint32_t span = XFER_BUF_LEN - idx;
+        if (span > space)
+            span = space;
+
+        uint32_t n = tud_cdc_n_read(XFER_ITF, &host_to_guest.buf[idx], span);
+        if (!n)
+            break;
+
+        head += n;
+        space -= n;
+    }
+
+    __mem_fence_release();
+    host_to_guest.head = head;
+}
+
+uint32_t xfer_status(void)
+{
+    uint32_t rx = ring_level(&host_to_guest);
+    uint32_t tx = XFER_BUF_LEN - ring_level(&guest_to_host);
+
+    if (rx > XFER_STATUS_RX_MASK)
+        rx = XFER_STATUS_RX_MASK;
+    if (tx > XFER_STATUS_RX_MASK)
+        tx = XFER_STATUS_RX_MASK;
+
+    return rx | (tx << XFER_STATUS_TX_SHIFT) | (host_connected ? XFER_STATUS_CONNECTED : 0);
+}
+
+// Returns 4 bytes, little endian, or 0 without consuming anything if fewer are waiting
+uint32_t xfer_read_word(void)
+{
+    uint32_t tail = host_to_guest.tail;
+    uint32_t level = host_to_guest.head - tail;
+    if (level < 4)
+        return 0;
+    __mem_fence_acquire();
+
+    uint32_t w = 0;
+    for (int i = 0; i < 4; i++)
+        w |= host_to_guest.buf[(tail + i) & (XFER_BUF_LEN - 1)] << (8 * i);
+
+    __mem_fence_release();
+    host_to_guest.tail = tail + 4;
+    rx_consumed(level, 4);
+    return w;
+}
+
+// Returns 1 byte, or 0 without consuming anything if nothing is waiting
+uint8_t xfer_read_byte(void)
+{
+    uint32_t tail = host_to_guest.tail;
+    uint32_t level = host_to_guest.head - tail;
+    if (!level)
+        return 0;
+    __mem_fence_acquire();
+
+    uint8_t b = host_to_guest.buf[tail & (XFER_BUF_LEN - 1)];
+
+    __mem_fence_release();
+    host_to_guest.tail = tail + 1;
+    rx_consumed(level, 1);
+    return b;
+}
+
+// Queues n bytes of w, little endian, with one doorbell. Without room for all of them nothing is
+// queued: the guest checks the free space in the status word instead of stalling in a CSR write.
+static void write_bytes(uint32_t w, uint32_t n)
+{
+    uint32_t head = guest_to_host.head;
+    if (XFER_BUF_LEN - (head - guest_to_host.tail) < n)
+        return;
+    __mem_fence_acquire();
+
+    for (uint32_t i = 0; i < n; i++)
+        guest_to_host.buf[(head + i) & (XFER_BUF_LEN - 1)] = w >> (8 * i);
+
+    __mem_fence_release();
+    guest_to_host.head = head + n;
+    console_doorbell();
+}
+
+void xfer_write_byte(uint8_t b)
+{
+    write_bytes(b, 1);
+}
+
+void xfer_write_word(uint32_t w)
+{
+    write_bytes(w, 4);
+}
+
+#endif
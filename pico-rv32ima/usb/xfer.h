@@ -0,0 +1,29 @@
+#ifndef _XFER_H
+#define _XFER_H
+
+#include "hw_config.h"
+#if USB_XFER
+
+#include <stdint.h>
+
+// Size of each direction's buffer, must be a power of two
+#define XFER_BUF_LEN 4096
+
+// Status word returned by xfer_status()
+#define XFER_STATUS_RX_MASK 0x7FFF        // bytes waiting for the guest
+#define XFER_STATUS_TX_SHIFT 16           // free space for the guest to write into
+#define XFER_STATUS_CONNECTED (1u << 31)  // host has the port open
+
+// Console core: moves data between the second CDC interface and the buffers
+void xfer_task(void);
+
+// Emulator core
+uint32_t xfer_status(void);
+uint32_t xfer_read_word(void);
+uint8_t xfer_read_byte(void);
+void xfer_write_word(uint32_t w);
+void xfer_write_byte(uint8_t b);
+
+#endif
+
+#endif
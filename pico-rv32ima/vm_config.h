@@ -19,12 +19,6 @@
 // Tie microsecond clock to instruction count
 #define EMULATOR_FIXED_UPDATE 0
 
-// Time divisor
-#define EMULATOR_TIME_DIV 1
-
-// Tie microsecond clock to instruction count
-#define EMULATOR_FIXED_UPDATE 0
-
 // Cache configuration
 #define CACHE_LINE_SIZE 16
 #define OFFSET_BITS 4 // log2(CACHE_LINE_SIZE)
@@ -0,0 +1,125 @@
+/*
+ * Guest side of the pico-rv32ima USB network interface (USB_NET in hw_config.h).
+ * Bridges the frames exchanged through the custom CSRs 0x190-0x194 (see hal_csr.h)
+ * to a TAP interface, so the guest sees a regular Ethernet device. Needs CONFIG_TUN.
+ *
+ * Build with the buildroot-tiny-rv32ima toolchain, e.g.
+ *     riscv32-buildroot-linux-uclibc-gcc -O2 -o usbnet usbnet.c
+ *
+ * Usage:
+ *     usbnet [IFNAME] &
+ *     ifconfig usb0 192.168.7.2 up
+ */
+
+#include <fcntl.h>
+#include <linux/if.h>
+#include <linux/if_tun.h>
+#include <poll.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+#include <sys/ioctl.h>
+#include <unistd.h>
+
+#define NET_FRAME_LEN 1514
+#define NET_STATUS_RX_MASK 0xFFFF
+#define NET_STATUS_TX_READY (1u << 16)
+#define NET_STATUS_LINK (1u << 31)
+
+// Poll period of the CSRs while the TAP side is idle
+#define IDLE_POLL_MS 2
+
+static inline uint32_t net_status(void)
+{
+    uint32_t v;
+    asm volatile("csrr %0, 0x190" : "=r"(v));
+    return v;
+}
+
+static inline uint32_t net_rx_word(void)
+{
+    uint32_t v;
+    asm volatile("csrr %0, 0x191" : "=r"(v));
+    return v;
+}
+
+static inline void net_rx_done(void)
+{
+    asm volatile("csrw 0x192, zero");
+}
+
+static inline void net_tx_word(uint32_t v)
+{
+    asm volatile("csrw 0x193, %0" ::"r"(v));
+}
+
+static inline void net_tx_send(uint32_t len)
+{
+    asm volatile("csrw 0x194, %0" ::"r"(len));
+}
+
+static int tap_open(const char *name)
+{
+    struct ifreq ifr;
+    int fd = open("/dev/net/tun", O_RDWR);
+    if (fd < 0)
+    {
+        perror("/dev/net/tun");
+        return -1;
+    }
+
+    memset(&ifr, 0, sizeof(ifr));
+    ifr.ifr_flags = IFF_TAP | IFF_NO_PI;
+    strncpy(ifr.ifr_name, name, IFNAMSIZ - 1);
+    if (ioctl(fd, TUNSETIFF, &ifr) < 0)
+    {
+        perror("TUNSETIFF");
+        close(fd);
+        return -1;
+    }
+    return fd;
+}
+
+int main(int argc, char **argv)
+{
+    uint32_t frame[(NET_FRAME_LEN + 3) / 4];
+    int fd = tap_open(argc > 1 ? argv[1] : "usb0");
+    if (fd < 0)
+        return 1;
+
+    for (;;)
+    {
+        uint32_t status = net_status();
+        int busy = 0;
+
+        // USB -> TAP
+        uint32_t len = status & NET_STATUS_RX_MASK;
+        if (len)
+        {
+            for (uint32_t i = 0; i < (len + 3) / 4; i++)
+                frame[i] = net_rx_word();
+            net_rx_done();
+            if (write(fd, frame, len) < 0)
+                perror("write");
+            busy = 1;
+        }
+
+        // TAP -> USB, only taken from the TAP queue when the link can send it
+        if ((status & NET_STATUS_LINK) && (status & NET_STATUS_TX_READY))
+        {
+            struct pollfd pfd = {.fd = fd, .events = POLLIN};
+            if (poll(&pfd, 1, busy ? 0 : IDLE_POLL_MS) > 0)
+            {
+                ssize_t n = read(fd, frame, sizeof(frame));
+                if (n > 0)
+                {
+                    for (ssize_t i = 0; i < (n + 3) / 4; i++)
+                        net_tx_word(frame[i]);
+                    net_tx_send(n);
+                }
+            }
+        }
+        else if (!busy)
+            usleep(IDLE_POLL_MS * 1000);
+    }
+}
@@ -0,0 +1,246 @@
+/*
+ * Guest side of the pico-rv32ima file transfer channel (USB_XFER in hw_config.h).
+ * Talks to the host through the custom CSRs 0x188-0x18A, see hal_csr.h and tools/xfer.py.
+ *
+ * Build with the buildroot-tiny-rv32ima toolchain, e.g.
+ *     riscv32-buildroot-linux-uclibc-gcc -O2 -o xfer xfer.c
+ *
+ * Usage:
+ *     xfer get [FILE]   receive a file pushed by `xfer.py PORT push`
+ *     xfer put FILE     send a file to `xfer.py PORT pull`
+ */
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define XFER_STATUS_RX_MASK 0x7FFF
+#define XFER_STATUS_TX_SHIFT 16
+
+static const char magic[4] = {'P', 'X', 'F', '1'};
+static uint32_t crc_table[256];
+
+static inline uint32_t xfer_status(void)
+{
+    uint32_t v;
+    asm volatile("csrr %0, 0x188" : "=r"(v));
+    return v;
+}
+
+static inline uint32_t xfer_rx_word(void)
+{
+    uint32_t v;
+    asm volatile("csrr %0, 0x189" : "=r"(v));
+    return v;
+}
+
+static inline uint32_t xfer_rx_byte(void)
+{
+    uint32_t v;
+    asm volatile("csrr %0, 0x18A" : "=r"(v));
+    return v;
+}
+
+static inline void xfer_tx_word(uint32_t v)
+{
+    asm volatile("csrw 0x189, %0" ::"r"(v));
+}
+
+static inline void xfer_tx_byte(uint32_t v)
+{
+    asm volatile("csrw 0x18A, %0" ::"r"(v));
+}
+
+static void crc_init(void)
+{
+    for (uint32_t i = 0; i < 256; i++)
+    {
+        uint32_t c = i;
+        for (int k = 0; k < 8; k++)
+            c = (c & 1) ? 0xEDB88320 ^ (c >> 1) : c >> 1;
+        crc_table[i] = c;
+    }
+}
+
+static uint32_t crc_update(uint32_t crc, const uint8_t *p, size_t n)
+{
+    crc = ~crc;
+    while (n--)
+        crc = crc_table[(crc ^ *p++) & 0xFF] ^ (crc >> 8);
+    return ~crc;
+}
+
+static void recv_bytes(uint8_t *p, size_t n)
+{
+    while (n)
+    {
+        uint32_t avail = xfer_status() & XFER_STATUS_RX_MASK;
+
+        while (avail >= 4 && n >= 4)
+        {
+            uint32_t w = xfer_rx_word();
+            memcpy(p, &w, 4);
+            p += 4;
+            n -= 4;
+            avail -= 4;
+        }
+
+        while (avail && n)
+        {
+            *p++ = xfer_rx_byte();
+            n--;
+            avail--;
+        }
+    }
+}
+
+static void send_bytes(const uint8_t *p, size_t n)
+{
+    while (n)
+    {
+        uint32_t space = xfer_status() >> XFER_STATUS_TX_SHIFT & XFER_STATUS_RX_MASK;
+
+        while (space >= 4 && n >= 4)
+        {
+            uint32_t w;
+            memcpy(&w, p, 4);
+            xfer_tx_word(w);
+            p += 4;
+            n -= 4;
+            space -= 4;
+        }
+
+        while (space && n)
+        {
+            xfer_tx_byte(*p++);
+            n--;
+            space--;
+        }
+    }
+}
+
+static uint32_t recv_u32(void)
+{
+    uint8_t b[4];
+    recv_bytes(b, 4);
+    return b[0] | b[1] << 8 | b[2] << 16 | (uint32_t)b[3] << 24;
+}
+
+static void send_u32(uint32_t v)
+{
+    uint8_t b[4] = {v, v >> 8, v >> 16, v >> 24};
+    send_bytes(b, 4);
+}
+
+static int get_file(const char *path)
+{
+    uint8_t m[4], nl[2];
+    char name[256];
+    uint8_t buf[4096];
+
+    recv_bytes(m, 4);
+    if (memcmp(m, magic, 4))
+    {
+        fprintf(stderr, "xfer: bad frame\n");
+        return 1;
+    }
+
+    recv_bytes(nl, 2);
+    uint32_t name_len = nl[0] | nl[1] << 8;
+    uint32_t skip = name_len >= sizeof(name) ? name_len - (sizeof(name) - 1) : 0;
+    recv_bytes((uint8_t *)name, name_len - skip);
+    name[name_len - skip] = 0;
+    while (skip--)
+        recv_bytes(buf, 1);
+
+    if (!path)
+        path = name;
+
+    FILE *f = fopen(path, "wb");
+    if (!f)
+        perror(path);
+
+    uint32_t size = recv_u32();
+    uint32_t crc = 0;
+    while (size)
+    {
+        uint32_t n = size < sizeof(buf) ? size : sizeof(buf);
+        recv_bytes(buf, n);
+        crc = crc_update(crc, buf, n);
+        if (f)
+            fwrite(buf, 1, n, f);
+        size -= n;
+    }
+
+    int ok = recv_u32() == crc && f && !ferror(f);
+    if (f)
+        fclose(f);
+
+    send_bytes((const uint8_t *)(ok ? "K" : "E"), 1);
+    if (!ok)
+    {
+        fprintf(stderr, "xfer: transfer failed\n");
+        remove(path);
+        return 1;
+    }
+    return 0;
+}
+
+static int put_file(const char *path)
+{
+    uint8_t buf[4096];
+
+    FILE *f = fopen(path, "rb");
+    if (!f)
+    {
+        perror(path);
+        return 1;
+    }
+
+    fseek(f, 0, SEEK_END);
+    uint32_t size = ftell(f);
+    fseek(f, 0, SEEK_SET);
+
+    const char *name = strrchr(path, '/');
+    name = name ? name + 1 : path;
+    uint32_t name_len = strlen(name);
+    uint8_t nl[2] = {name_len, name_len >> 8};
+
+    send_bytes((const uint8_t *)magic, 4);
+    send_bytes(nl, 2);
+    send_bytes((const uint8_t *)name, name_len);
+    send_u32(size);
+
+    uint32_t crc = 0;
+    size_t n;
+    while ((n = fread(buf, 1, sizeof(buf), f)) > 0)
+    {
+        crc = crc_update(crc, buf, n);
+        send_bytes(buf, n);
+    }
+    fclose(f);
+    send_u32(crc);
+
+    uint8_t ack;
+    recv_bytes(&ack, 1);
+    if (ack != 'K')
+    {
+        fprintf(stderr, "xfer: host reported an error\n");
+        return 1;
+    }
+    return 0;
+}
+
+int main(int argc, char **argv)
+{
+    crc_init();
+
+    if (argc >= 2 && !strcmp(argv[1], "get"))
+        return get_file(argc >= 3 ? argv[2] : NULL);
+    if (argc == 3 && !strcmp(argv[1], "put"))
+        return put_file(argv[2]);
+
+    fprintf(stderr, "usage: %s get [FILE] | put FILE\n", argv[0]);
+    return 2;
+}
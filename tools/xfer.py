@@ -0,0 +1,105 @@
+#!/usr/bin/env python3
+"""Copy files to and from a pico-rv32ima guest over the file transfer CDC port.
+
+Enable USB_XFER in hw_config.h. The board then shows up as two serial ports:
+the console and the transfer channel. In the guest, run `xfer get` (to
+receive) or `xfer put FILE` (to send), built from tools/guest/xfer.c.
+
+    xfer.py PORT push LOCAL_FILE [REMOTE_NAME]   # guest runs: xfer get
+    xfer.py PORT pull [LOCAL_FILE]               # guest runs: xfer put FILE
+
+Frame format, shared with the guest tool (all integers little endian):
+    "PXF1", u16 name length, name, u32 size, data, u32 CRC-32 of data
+The receiver answers with b"K" if the CRC matches, b"E" otherwise.
+"""
+
+import argparse
+import os
+import struct
+import sys
+import time
+import zlib
+
+import serial
+
+MAGIC = b"PXF1"
+CHUNK = 16384
+
+
+def read_exact(port, n):
+    data = bytearray()
+    while len(data) < n:
+        part = port.read(n - len(data))
+        if not part:
+            raise TimeoutError("timed out waiting for the guest")
+        data += part
+    return bytes(data)
+
+
+def push(port, path, name):
+    with open(path, "rb") as f:
+        data = f.read()
+    name = name.encode()
+
+    start = time.monotonic()
+    port.write(MAGIC + struct.pack("<H", len(name)) + name + struct.pack("<I", len(data)))
+    for i in range(0, len(data), CHUNK):
+        port.write(data[i:i + CHUNK])
+    port.write(struct.pack("<I", zlib.crc32(data)))
+    port.flush()
+
+    ack = read_exact(port, 1)
+    elapsed = time.monotonic() - start
+    if ack != b"K":
+        sys.exit("guest reported a CRC error")
+    print(f"sent {len(data)} bytes in {elapsed:.2f}s ({len(data) / elapsed / 1024:.1f} KiB/s)")
+
+
+def pull(port, path):
+    # Wait for the guest to start sending, without a timeout
+    port.timeout = None
+    magic = read_exact(port, 4)
+    port.timeout = 5
+    if magic != MAGIC:
+        sys.exit("unexpected data on the transfer port")
+
+    start = time.monotonic()
+    (name_len,) = struct.unpack("<H", read_exact(port, 2))
+    name = read_exact(port, name_len).decode()
+    (size,) = struct.unpack("<I", read_exact(port, 4))
+    data = read_exact(port, size)
+    (crc,) = struct.unpack("<I", read_exact(port, 4))
+
+    if zlib.crc32(data) != crc:
+        port.write(b"E")
+        sys.exit("CRC error")
+    port.write(b"K")
+
+    path = path or os.path.basename(name)
+    with open(path, "wb") as f:
+        f.write(data)
+    elapsed = time.monotonic() - start
+    print(f"received {name} -> {path}, {size} bytes in {elapsed:.2f}s ({size / elapsed / 1024:.1f} KiB/s)")
+
+
+def main():
+    ap = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    ap.add_argument("port", help="serial port of the transfer channel")
+    sub = ap.add_subparsers(dest="cmd", required=True)
+    p = sub.add_parser("push", help="send a file to the guest")
+    p.add_argument("file")
+    p.add_argument("name", nargs="?")
+    p = sub.add_parser("pull", help="receive a file from the guest")
+    p.add_argument("file", nargs="?")
+    args = ap.parse_args()
+
+    with serial.Serial(args.port, timeout=30) as port:
+        port.reset_input_buffer()
+        if args.cmd == "push":
+            push(port, args.file, args.name or os.path.basename(args.file))
+        else:
+            pull(port, args.file)
+
+
+if __name__ == "__main__":
+    main()